@@ -0,0 +1,37 @@
+# CMake toolchain file for GNU Arm Embedded (arm-none-eabi-gcc), Cortex-M4F
+#
+#   cmake -S . -B build-arm -DCMAKE_TOOLCHAIN_FILE=GCC/arm-none-eabi.cmake -DCMAKE_BUILD_TYPE=Release
+#
+# Toolchain not in PATH: -DARM_TOOLCHAIN_DIR=/opt/gcc-arm-none-eabi/bin
+
+set(CMAKE_SYSTEM_NAME Generic)
+set(CMAKE_SYSTEM_PROCESSOR arm)
+
+set(ARM_TOOLCHAIN_DIR "" CACHE PATH "Directory of arm-none-eabi-gcc, empty - PATH")
+if(ARM_TOOLCHAIN_DIR)
+  set(_prefix "${ARM_TOOLCHAIN_DIR}/arm-none-eabi-")
+else()
+  set(_prefix "arm-none-eabi-")
+endif()
+
+set(CMAKE_C_COMPILER   "${_prefix}gcc")
+set(CMAKE_CXX_COMPILER "${_prefix}g++")
+set(CMAKE_ASM_COMPILER "${_prefix}gcc")
+set(CMAKE_OBJCOPY      "${_prefix}objcopy" CACHE FILEPATH "")
+set(CMAKE_SIZE         "${_prefix}size" CACHE FILEPATH "")
+set(CMAKE_AR           "${_prefix}gcc-ar" CACHE FILEPATH "")
+set(CMAKE_RANLIB       "${_prefix}gcc-ranlib" CACHE FILEPATH "")
+
+# compiler check links without startup code
+set(CMAKE_TRY_COMPILE_TARGET_TYPE STATIC_LIBRARY)
+
+set(_cpu "-mcpu=cortex-m4 -mthumb -mfpu=fpv4-sp-d16 -mfloat-abi=hard")
+set(CMAKE_C_FLAGS_INIT   "${_cpu} -ffunction-sections -fdata-sections")
+set(CMAKE_CXX_FLAGS_INIT "${_cpu} -ffunction-sections -fdata-sections -fno-exceptions -fno-rtti")
+set(CMAKE_ASM_FLAGS_INIT "${_cpu} -x assembler-with-cpp")
+# newlib-nano printf without float support prints nothing for %f (bench CSV)
+set(CMAKE_EXE_LINKER_FLAGS_INIT "${_cpu} --specs=nano.specs --specs=nosys.specs -u _printf_float -Wl,--gc-sections")
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
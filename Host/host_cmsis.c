@@ -0,0 +1,74 @@
+/***********************************************************************
+ File Name    : 'host_cmsis.c'
+ Title        : PROFILER
+ Description  : Core registers of host build (see Host/stm32f30x.h).
+                DWT->CYCCNT is refreshed on every DWT access from
+                CLOCK_MONOTONIC, scaled to SystemCoreClock, and runs
+                only while DWT_CTRL_CYCCNTENA is set, like on target.
+                HOST_dwt_manual stops the clock, CYCCNT changes only by
+                writes, for tests with exact cycle counts.
+ Target MCU   : Host (Linux, gcc/clang)
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "stm32f30x.h"
+#include <time.h>
+
+/* Exported variables ------------------------------------------------*/
+uint32_t       SystemCoreClock = 72000000;
+CoreDebug_Type HOST_CoreDebug;
+uint32_t       HOST_DWT_LAR;
+uint32_t       HOST_primask;
+uint32_t       HOST_basepri;
+uint32_t       HOST_ipsr;
+uint8_t        HOST_dwt_manual;
+
+/* Private variables -------------------------------------------------*/
+static DWT_Type host_dwt;
+static uint8_t  host_running;   // counting since host_ns_base
+static uint64_t host_ns_base;
+static uint32_t host_cyc_base;  // CYCCNT at host_ns_base
+static uint32_t host_cyc_last;  // last returned, detects writes
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief DWT registers with CYCCNT brought up to date
+ */
+DWT_Type *HOST_Dwt(void)
+{
+  struct timespec ts;
+  uint64_t ns;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  ns = (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+
+  if (HOST_dwt_manual)
+  {
+    host_running = 0;
+  }
+  else if (host_dwt.CTRL & DWT_CTRL_CYCCNTENA_Msk)
+  {
+    // (re)start counting after enable or write to CYCCNT
+    if (!host_running || host_dwt.CYCCNT != host_cyc_last)
+    {
+      host_running = 1;
+      host_ns_base = ns;
+      host_cyc_base = host_dwt.CYCCNT;
+    }
+    host_dwt.CYCCNT = host_cyc_base + (uint32_t)((ns - host_ns_base) * SystemCoreClock / 1000000000u);
+    // keep ns * SystemCoreClock in 64 bit
+    if (ns - host_ns_base > 1000000000u)
+    {
+      host_ns_base = ns;
+      host_cyc_base = host_dwt.CYCCNT;
+    }
+  }
+  else
+  {
+    host_running = 0;
+  }
+  host_cyc_last = host_dwt.CYCCNT;
+  return &host_dwt;
+}
@@ -0,0 +1,98 @@
+/***********************************************************************
+ File Name    : 'host_flash.c'
+ Title        : PROFILER
+ Description  : Capture log flash port of host build, RAM simulator.
+                Erase sets page to 0xFF, half word program needs erased
+                half word and unlocked flash, like STM32F30x (PGERR).
+                HOST_flash_ops = n: power fails in n-th erase or program
+                operation from now, it is torn (erase clears only first
+                half of the page, program is not done) and all later
+                ones fail until HOST_flash_ops is set again.
+                HOST_flash_erases counts erases per page (wear).
+ Target MCU   : Host (Linux, gcc/clang)
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_flash_port.h"
+#include <string.h>
+
+#if PROFILING_FLASH_LOG
+
+/* Exported variables ------------------------------------------------*/
+uint32_t HOST_flash[PROFILING_FLASH_LOG_PAGES * PROF_FLASH_PAGE_SIZE / 4];
+int32_t  HOST_flash_ops = -1;   // operations until power fail, -1 never, 0 no power
+uint32_t HOST_flash_erases[PROFILING_FLASH_LOG_PAGES];
+
+/* Private variables -------------------------------------------------*/
+static uint8_t flash_unlocked;
+
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Power fail countdown
+ *
+ * @return 1 - operation done, 0 - torn by power fail, -1 - no power
+ */
+static int flash_power(void)
+{
+  if (HOST_flash_ops < 0)
+    return 1;
+  if (HOST_flash_ops == 0)
+    return -1;
+  return --HOST_flash_ops ? 1 : 0;
+}
+
+
+uintptr_t PROF_FLASH_PortBase(void)
+{
+  return (uintptr_t)HOST_flash;
+}
+
+
+void PROF_FLASH_PortUnlock(void)
+{
+  flash_unlocked = 1;
+}
+
+
+void PROF_FLASH_PortLock(void)
+{
+  flash_unlocked = 0;
+}
+
+
+uint8_t PROF_FLASH_PortErase(uintptr_t addr)
+{
+  uintptr_t off = addr - (uintptr_t)HOST_flash;
+  int power;
+
+  if (!flash_unlocked || off % PROF_FLASH_PAGE_SIZE || off >= sizeof(HOST_flash))
+    return 0;
+
+  power = flash_power();
+  if (power == 0)
+    memset((uint8_t *)HOST_flash + off, 0xFF, PROF_FLASH_PAGE_SIZE / 2);
+  if (power < 1)
+    return 0;
+  memset((uint8_t *)HOST_flash + off, 0xFF, PROF_FLASH_PAGE_SIZE);
+  HOST_flash_erases[off / PROF_FLASH_PAGE_SIZE]++;
+  return 1;
+}
+
+
+uint8_t PROF_FLASH_PortProgram(uintptr_t addr, uint16_t data)
+{
+  uintptr_t off = addr - (uintptr_t)HOST_flash;
+  uint16_t *hw = (uint16_t *)addr;
+
+  if (!flash_unlocked || (off & 1) || off >= sizeof(HOST_flash) || *hw != 0xFFFF)
+    return 0;
+  if (flash_power() < 1)
+    return 0;
+  *hw = data;
+  return 1;
+}
+
+#endif // PROFILING_FLASH_LOG
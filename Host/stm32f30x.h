@@ -0,0 +1,73 @@
+/***********************************************************************
+ File Name    : 'stm32f30x.h'
+ Title        : PROFILER
+ Description  : Host build replacement of CMSIS device header.
+                Only the core registers and intrinsics used by profiler
+                sources. DWT->CYCCNT counts SystemCoreClock cycles of
+                host monotonic clock, interrupt masking is a flag.
+                Found before Drivers/CMSIS in host include path.
+ Target MCU   : Host (Linux, gcc/clang)
+ Editor Tabs  : 2
+***********************************************************************/
+
+#ifndef __STM32F30x_H
+#define __STM32F30x_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define __I                     volatile const
+#define __O                     volatile
+#define __IO                    volatile
+#define __STATIC_INLINE         static inline
+
+typedef struct
+{
+  __IO uint32_t CTRL;
+  __IO uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+  __IO uint32_t DEMCR;
+} CoreDebug_Type;
+
+#define DWT_CTRL_CYCCNTENA_Msk        (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk    (1UL << 24)
+
+extern uint32_t       SystemCoreClock;
+extern CoreDebug_Type HOST_CoreDebug;
+extern uint32_t       HOST_DWT_LAR;
+extern uint32_t       HOST_primask;
+extern uint32_t       HOST_basepri;
+extern uint32_t       HOST_ipsr;         // active exception, 0 - thread mode
+extern uint8_t        HOST_dwt_manual;   // CYCCNT changes only by writes
+extern uint32_t       HOST_flash[];      // flash log simulator, Host/host_flash.c
+extern int32_t        HOST_flash_ops;
+extern uint32_t       HOST_flash_erases[];
+
+DWT_Type *HOST_Dwt(void);
+
+#define DWT                     (HOST_Dwt())
+#define DWT_LAR                 HOST_DWT_LAR
+#define CoreDebug               (&HOST_CoreDebug)
+
+__STATIC_INLINE uint32_t __get_PRIMASK(void)  { return HOST_primask; }
+__STATIC_INLINE void __disable_irq(void)      { HOST_primask = 1; }
+__STATIC_INLINE void __enable_irq(void)       { HOST_primask = 0; }
+__STATIC_INLINE uint32_t __get_BASEPRI(void)  { return HOST_basepri; }
+__STATIC_INLINE void __set_BASEPRI(uint32_t basepri) { HOST_basepri = basepri; }
+__STATIC_INLINE uint32_t __get_IPSR(void)     { return HOST_ipsr; }
+__STATIC_INLINE void __DSB(void)              { }
+__STATIC_INLINE void __ISB(void)              { }
+__STATIC_INLINE void __NOP(void)              { }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // __STM32F30x_H
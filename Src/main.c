@@ -28,11 +28,18 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f30x.h"
 #include "profiling.h"
+#include "profiling_load.h"
+#include "profiling_fault.h"
+#include "profiling_flash.h"
+#include "profiling_bkp.h"
+#include "profiling_delay.h"
+#include "profiling_trig.h"
 #include <stdbool.h>
 
 extern __IO int32_t Tick;
 /* Private variables ---------------------------------------------------------*/
 static int32_t delay_tick;
+static const char ev_wait_tick[] = "Wait for update Tick";
 
 /* Private function prototypes -----------------------------------------------*/
 static void Init_TIM6(void);
@@ -67,7 +74,17 @@ void TIM6_DAC_IRQHandler(void)
  */
 int main(void)
 {
+#if !PROFILING_TICKLESS
   SysTick_Config(SystemCoreClock / 1000);
+#endif
+  PROF_DELAY_Init();
+  PROF_LOAD_Init();
+  PROF_FAULT_Report();
+  PROF_FLASH_Init();
+  PROF_BKP_Init();
+  PROF_BKP_Track(0, ev_wait_tick);
+  PROF_TRIG_Rule(0, ev_wait_tick, 900, NULL);
+  PROF_TRIG_Arm(8, 4);
 
   PROFILING_START("MAIN startup timing");
 
@@ -82,21 +99,39 @@ int main(void)
   {
     PROFILING_START("MAIN loop timing");
 
+#if PROFILING_DELAY
+    GPIO_WriteBit(GPIOE, GPIO_Pin_9, (((PROF_DELAY_Millis() % 1000) > 500) ? Bit_SET : Bit_RESET));
+    PROFILING_EVENT("GPIO_WriteBit(...)");
+
+    // Wait for update Tick (next millisecond of DWT time base)
+    delay_tick = PROF_DELAY_Millis();
+    while (delay_tick == PROF_DELAY_Millis());
+    PROFILING_EVENT(ev_wait_tick);
+
+    // Delay 1000 ms, WFI until last PROFILING_DELAY_SPIN_US
+    PROF_DELAY_Sleep_ms(1000);
+    PROFILING_EVENT("DELAY 1 s");
+#else
     GPIO_WriteBit(GPIOE, GPIO_Pin_9, (((Tick % 1000) > 500) ? Bit_SET : Bit_RESET));
     PROFILING_EVENT("GPIO_WriteBit(...)");
 
     // Wait for update Tick
     delay_tick = Tick;
     while (delay_tick == Tick);
-    PROFILING_EVENT("Wait for update Tick");
+    PROFILING_EVENT(ev_wait_tick);
 
     // Delay 1000 ms
     delay_tick = Tick + 1000;
-    while (delay_tick > Tick);
+    while (delay_tick > Tick)
+      PROF_LOAD_Idle();
     PROFILING_EVENT("DELAY 1 s");
+#endif
 
     // Stop profiling and print
     PROFILING_STOP();
+
+    // Write capture to flash log outside of profiled code
+    PROF_FLASH_Flush();
   }
 }
 
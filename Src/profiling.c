@@ -26,22 +26,51 @@
 
 /* Includes ----------------------------------------------------------*/
 #include "profiling.h"
+#include "profiling_cs.h"
+#include "profiling_stack.h"
+#include "profiling_load.h"
+#include "profiling_ctx.h"
+#include "profiling_flash.h"
+#include "profiling_boot.h"
+#include "profiling_rtc.h"
+#include "profiling_clock.h"
+#include "profiling_bkp.h"
+#include "profiling_sample.h"
+#include "profiling_drv.h"
+#include "profiling_call.h"
+#include "profiling_trig.h"
 
 /* Private Definitions -----------------------------------------------*/
 #define DEBUG_PRINTF printf
-#define __PROF_STOPED 0xFF
+
+struct prof_session_s
+{
+  uint32_t   time_start; // profiler start time
+  const char *prof_name; // profiler name
+  uint32_t   time_event[MAX_EVENT_COUNT]; // events time
+  const char *event_name[MAX_EVENT_COUNT]; // events name
+  uint8_t    event_count; // events counter
+  uint8_t    running;     // session started
+};
+typedef struct prof_session_s prof_session_t;
 
 /* External variables ------------------------------------------------*/
 /* Private variables -------------------------------------------------*/
-static uint32_t   time_start; // profiler start time
-static const char *prof_name; // profiler name
-static uint32_t   time_event[MAX_EVENT_COUNT]; // events time
-static const char *event_name[MAX_EVENT_COUNT]; // events name
-static uint8_t    event_count = __PROF_STOPED; // events counter
+#if PROFILING_ENABLE
+static prof_session_t session[PROFILING_CONTEXT_COUNT] PROF_HOT_DATA; // one session per context
+#if PROFILING_SESSION_POOL
+static prof_session_t pool[PROFILING_SESSION_POOL] PROF_HOT_DATA; // PROFILING_SESSION_START() handles
+#endif
+uint32_t PROF_cat_mask = PROF_CAT_ALL; // runtime enabled categories
 
 /* Private function prototypes ---------------------------------------*/
+static int32_t prof_time_us(uint32_t t0, uint32_t t1);
+static void prof_print(const prof_session_t *s);
+static uint8_t prof_others_running(const prof_session_t *s);
+#endif
 /* -------------------------------------------------------------------*/
 
+#if defined(__CC_ARM)
 /**
  * redefinition fputc() for output printf(..) to ITM Stimulus Port 0
  */
@@ -54,23 +83,147 @@ int fputc(int ch, FILE *f)
   ITM_SendChar(ch);
   return(ch);
 }
+#elif defined(__arm__)
+/**
+ * newlib write() for output printf(..) to ITM Stimulus Port 0
+ */
+int _write(int file, char *ptr, int len)
+{
+  for (int i = 0; i < len; i++)
+    ITM_SendChar(ptr[i]);
+  return len;
+}
+#endif
+
+#if PROFILING_ENABLE
+
+
+/**
+ * @brief Interval t0..t1 in us
+ */
+static int32_t prof_time_us(uint32_t t0, uint32_t t1)
+{
+#if PROFILING_CLOCK_EPOCHS
+  return PROF_CLOCK_ToUs(t0, t1);
+#else
+  return (t1 - t0) / (SystemCoreClock / 1000000);
+#endif
+}
+
+
+/**
+ * @brief Save event name and time, common part of PROFILING_EVENT and
+ *        PROFILING_SESSION_EVENT
+ */
+__STATIC_INLINE void prof_record(prof_session_t *s, const char *event, uint32_t now)
+{
+  if (s->event_count < MAX_EVENT_COUNT)
+  {
+    s->time_event[s->event_count] = now;
+    s->event_name[s->event_count] = event;
+    s->event_count++;
+  }
+}
+
+
+/**
+ * @brief Check for running PROFILING_START session of other contexts
+ */
+static uint8_t prof_others_running(const prof_session_t *s)
+{
+  for (int i = 0; i < PROFILING_CONTEXT_COUNT; i++)
+  {
+    if (&session[i] != s && session[i].running)
+      return 1;
+  }
+  return 0;
+}
+
+
+/**
+ * @brief Print event table of session to ITM Stimulus Port 0
+ */
+static void prof_print(const prof_session_t *s)
+{
+  int32_t time_prev;
+  int32_t timestamp;
+  int32_t delta_t;
+
+  DEBUG_PRINTF("Profiling \"%s\" sequence: \r\n"
+               "--Event-----------------------|--timestamp--|----delta_t---\r\n", s->prof_name);
+  time_prev = 0;
+
+  for (int i = 0; i < s->event_count; i++)
+  {
+    timestamp = prof_time_us(s->time_start, s->time_event[i]);
+    delta_t = timestamp - time_prev;
+    time_prev = timestamp;
+    DEBUG_PRINTF("%-30s:%9d s | +%9d s\r\n", s->event_name[i], (int)timestamp, (int)delta_t);
+  }
+  DEBUG_PRINTF("\r\n");
+}
 
 
 /**
- * @brief Start profiler, save profiler name and start time
+ * @brief Start profiler, save profiler name and start time.
+ *        Module statistics are shared by contexts, only first session
+ *        of all contexts resets them
  *
  * @param profile_name Profiler name
  */
 void PROFILING_START(const char *profile_name)
 {
-  prof_name = profile_name;
-  event_count = 0;
+  prof_session_t *s = &session[PROF_CTX_CURRENT()];
+  uint32_t primask = __get_PRIMASK();
+  uint8_t first;
 
-  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
-  DWT->LAR = 0xC5ACCE55;
-  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk; // enable counter
+  s->prof_name = profile_name;
+  s->event_count = PROF_BOOT_Take(&s->time_start, s->time_event, s->event_name, MAX_EVENT_COUNT);
+  __disable_irq();
+  first = !prof_others_running(s);
+  s->running = 1;
+  if (!primask)
+    __enable_irq();
+
+  PROF_CYCCNT_ENABLE();
   //DWT->CYCCNT  = time_start = 0;
-  time_start = DWT->CYCCNT;
+  if (first)
+  {
+    PROF_CS_Reset();
+    PROF_SAMPLE_Reset();
+    PROF_DRV_Reset();
+    PROF_CALL_Reset();
+    PROF_CTX_Reset();
+    PROF_STACK_Paint();
+  }
+  PROF_RTC_Anchor();
+  // first session after reset counts time from reset (boot phases)
+  if (!s->event_count)
+    s->time_start = DWT->CYCCNT;
+  PROF_TRIG_Start(DWT->CYCCNT);
+}
+
+
+/**
+ * @brief Event of current context session, common part of PROFILING_EVENT
+ *        and PROF_Event
+ *
+ * @return 1 if stored, 0 if no session is running or event table is full
+ */
+__STATIC_INLINE uint8_t prof_event(const char *event)
+{
+  prof_session_t *s = &session[PROF_CTX_CURRENT()];
+  uint32_t now = DWT->CYCCNT;
+
+  if (!s->running)
+    return 0;
+
+  PROF_TRIG_Event(event, now);
+  if (s->event_count >= MAX_EVENT_COUNT)
+    return 0;
+  PROF_BKP_Event(event, now - (s->event_count ? s->time_event[s->event_count - 1] : s->time_start));
+  prof_record(s, event, now);
+  return 1;
 }
 
 
@@ -79,50 +232,198 @@ void PROFILING_START(const char *profile_name)
  *
  * @param event Event name
  */
-void PROFILING_EVENT(const char *event)
+PROF_HOT_CODE void PROFILING_EVENT(const char *event)
 {
-  if (event_count == __PROF_STOPED)
-    return;
+  prof_event(event);
+}
+
+
+/**
+ * @brief  PROFILING_EVENT with result, used by sampled events
+ *
+ * @param event Event name
+ * @return 1 if stored, 0 if no session is running or event table is full
+ */
+PROF_HOT_CODE uint8_t PROF_Event(const char *event)
+{
+  return prof_event(event);
+}
+
 
-  if (event_count < MAX_EVENT_COUNT)
+/**
+ * @brief Check for any started session
+ *
+ * @return 1 if session of any context or handle session is running
+ */
+uint8_t PROFILING_IS_RUNNING(void)
+{
+  for (int i = 0; i < PROFILING_CONTEXT_COUNT; i++)
+  {
+    if (session[i].running)
+      return 1;
+  }
+#if PROFILING_SESSION_POOL
+  for (int i = 0; i < PROFILING_SESSION_POOL; i++)
   {
-    time_event[event_count] = DWT->CYCCNT;
-    event_name[event_count] = event;
-    event_count++;
+    if (pool[i].running)
+      return 1;
   }
+#endif
+  return 0;
 }
 
 
 /**
- * @brief Stop profiler. Print event table to ITM Stimulus Port 0
+ * @brief Copy last events of current session. Safe to call from fault handler
+ *
+ * @param profile_name Profiler name, NULL if session not started
+ * @param time  Event times, cycles from session start
+ * @param event Event names
+ * @param max   Size of time[] and event[]
+ *
+ * @return Number of copied events
  */
-void PROFILING_STOP(void)
+uint8_t PROFILING_GET_EVENTS(const char **profile_name, uint32_t *time, const char **event, uint8_t max)
 {
-  int32_t tick_per_1us;
-  int32_t time_prev;
-  int32_t timestamp;
-  int32_t delta_t;
+  prof_session_t *s = &session[PROF_CTX_CURRENT()];
+  uint8_t first;
+  uint8_t count;
+
+  *profile_name = s->running ? s->prof_name : NULL;
+  if (!s->running)
+    return 0;
+
+  first = (s->event_count > max) ? s->event_count - max : 0;
+  count = s->event_count - first;
+  for (int i = 0; i < count; i++)
+  {
+    time[i] = s->time_event[first + i] - s->time_start;
+    event[i] = s->event_name[first + i];
+  }
+  return count;
+}
 
-  tick_per_1us = SystemCoreClock / 1000000;
 
-  if (event_count == __PROF_STOPED)
+/**
+ * @brief Stop profiler. Print event table to ITM Stimulus Port 0.
+ *        Module statistics are printed by last running session of all
+ *        contexts
+ */
+void PROFILING_STOP(void)
+{
+  prof_session_t *s = &session[PROF_CTX_CURRENT()];
+  uint32_t primask = __get_PRIMASK();
+  uint8_t last;
+
+  if (!s->running)
   {
     DEBUG_PRINTF("\r\nWarning: PROFILING_STOP WITHOUT START.\r\n");
     return;
   }
 
-  DEBUG_PRINTF("Profiling \"%s\" sequence: \r\n"
-               "--Event-----------------------|--timestamp--|----delta_t---\r\n", prof_name);
-  time_prev = 0;
+  // armed trigger replaces event table, capture printed only
+  if (!PROF_TRIG_Armed())
+    prof_print(s);
+  PROF_TRIG_Report();
+  PROF_RTC_Report(s->time_start);
+  PROF_FLASH_Save();
 
-  for (int i = 0; i < event_count; i++)
+  __disable_irq();
+  s->running = 0;
+  last = !prof_others_running(s);
+  if (!primask)
+    __enable_irq();
+
+  if (last)
   {
-    timestamp = (time_event[i] - time_start) / tick_per_1us;
-    delta_t = timestamp - time_prev;
-    time_prev = timestamp;
-    DEBUG_PRINTF("%-30s:%9d s | +%9d s\r\n", event_name[i], timestamp, delta_t);
+    PROF_SAMPLE_Report();
+    PROF_DRV_Report();
+    PROF_CALL_Report();
+    PROF_CS_Report();
+    PROF_STACK_Report();
+    PROF_LOAD_Report();
+    PROF_CTX_Report();
+    PROF_BKP_Report();
+    PROF_BKP_Save();
   }
-  DEBUG_PRINTF("\r\n");
-  event_count = __PROF_STOPED;
 }
 
+
+#if PROFILING_SESSION_POOL
+
+/**
+ * @brief Start session from static pool, independent of PROFILING_START
+ *        session and of other handles. Only the event table is kept,
+ *        module statistics belong to PROFILING_START session
+ *
+ * @param profile_name Profiler name
+ * @return Handle, NULL if all PROFILING_SESSION_POOL sessions are running
+ */
+PROF_Session_t *PROFILING_SESSION_START(const char *profile_name)
+{
+  uint32_t primask = __get_PRIMASK();
+  prof_session_t *s = NULL;
+
+  __disable_irq();
+  for (int i = 0; i < PROFILING_SESSION_POOL; i++)
+  {
+    if (!pool[i].running)
+    {
+      s = &pool[i];
+      s->running = 1;
+      break;
+    }
+  }
+  if (!primask)
+    __enable_irq();
+
+  if (s)
+  {
+    PROF_CYCCNT_ENABLE();
+    s->prof_name = profile_name;
+    s->event_count = 0;
+    s->time_start = DWT->CYCCNT;
+  }
+  return s;
+}
+
+
+/**
+ * @brief Event of handle session, NULL handle ignored
+ */
+PROF_HOT_CODE void PROFILING_SESSION_EVENT(PROF_Session_t *s, const char *event)
+{
+  uint32_t now = DWT->CYCCNT;
+
+  if (s && s->running)
+    prof_record(s, event, now);
+}
+
+
+/**
+ * @brief Print event table of handle session and return it to pool,
+ *        NULL handle ignored
+ */
+void PROFILING_SESSION_STOP(PROF_Session_t *s)
+{
+  if (!s || !s->running)
+    return;
+
+  prof_print(s);
+  s->running = 0;
+}
+
+#endif // PROFILING_SESSION_POOL
+
+
+/**
+ * @brief Set runtime enabled categories for PROFILING_xxx_CAT()
+ *
+ * @param mask PROF_CAT_xxx bits
+ */
+void PROFILING_SET_MASK(uint32_t mask)
+{
+  PROF_cat_mask = mask;
+}
+
+#endif // PROFILING_ENABLE
@@ -5,11 +5,120 @@
 //#include "stm32f1xx_hal.h"
 #include <stdint.h>
 #include <stdio.h>
+#include "profiling_conf.h"
 
 #define MAX_EVENT_COUNT 20
 
+// DWT Lock Access Register, not in CMSIS DWT_Type
+#ifndef DWT_LAR
+#define DWT_LAR                 (*(__O uint32_t *)(DWT_BASE + 0xFB0))
+#endif
+
+// enable DWT cycle counter
+#define PROF_CYCCNT_ENABLE()                            \
+  do {                                                  \
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     \
+    DWT_LAR = 0xC5ACCE55;                               \
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                \
+  } while (0)
+
+#if defined(__CC_ARM)
+#define PROF_RETURN_ADDRESS()   __return_address()
+#else
+#define PROF_RETURN_ADDRESS()   ((uint32_t)(uintptr_t)__builtin_return_address(0))
+#endif
+
+// not initialized on reset, placed in RW_NOINIT region (PROFILER.sct)
+#if defined(__CC_ARM)
+#define PROF_NOINIT             __attribute__((section(".bss.noinit"), zero_init))
+#else
+#define PROF_NOINIT             __attribute__((section(".noinit")))
+#endif
+
+// code and zero initialized data in CCM RAM, RW_CCM region (PROFILER.sct),
+// copied and cleared by scatter loading / Reset_Handler (GCC)
+#if defined(__CC_ARM)
+#define PROF_CCM_CODE           __attribute__((section(".ccm.text"), noinline))
+#define PROF_CCM_DATA           __attribute__((section(".bss.ccm"), zero_init))
+#else
+#define PROF_CCM_CODE           __attribute__((section(".ccmram.text"), noinline))
+#define PROF_CCM_DATA           __attribute__((section(".ccmbss")))
+#endif
+
+// profiler hot path and session buffers
+#if PROFILING_CCM
+#define PROF_HOT_CODE           PROF_CCM_CODE
+#define PROF_HOT_DATA           PROF_CCM_DATA
+#else
+#define PROF_HOT_CODE
+#define PROF_HOT_DATA
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// handle of PROFILING_SESSION_START() session
+typedef struct prof_session_s PROF_Session_t;
+
+#if PROFILING_ENABLE
+
 void PROFILING_START(const char *profile_name);
 void PROFILING_EVENT(const char *event);
+uint8_t PROF_Event(const char *event);
 void PROFILING_STOP(void);
+void PROFILING_SET_MASK(uint32_t mask);
+uint8_t PROFILING_IS_RUNNING(void);
+uint8_t PROFILING_GET_EVENTS(const char **profile_name, uint32_t *time, const char **event, uint8_t max);
+
+#if PROFILING_SESSION_POOL
+PROF_Session_t *PROFILING_SESSION_START(const char *profile_name);
+void PROFILING_SESSION_EVENT(PROF_Session_t *session, const char *event);
+void PROFILING_SESSION_STOP(PROF_Session_t *session);
+#else
+#define PROFILING_SESSION_START(name)   ((PROF_Session_t *)0)
+#define PROFILING_SESSION_EVENT(s, e)   ((void)0)
+#define PROFILING_SESSION_STOP(s)       ((void)0)
+#endif
+
+extern uint32_t PROF_cat_mask;  // runtime enabled categories
+
+/**
+ * Category variants. Category out of PROFILING_CAT_MASK compiles to
+ * nothing, otherwise one test of PROF_cat_mask and branch.
+ */
+#define PROF_CAT_ON(cat)        (((cat) & PROFILING_CAT_MASK) && ((cat) & PROF_cat_mask))
+
+#define PROFILING_START_CAT(cat, name)  do { if (PROF_CAT_ON(cat)) PROFILING_START(name); } while (0)
+#define PROFILING_EVENT_CAT(cat, event) do { if (PROF_CAT_ON(cat)) PROFILING_EVENT(event); } while (0)
+#define PROFILING_STOP_CAT(cat)         do { if (PROF_CAT_ON(cat)) PROFILING_STOP(); } while (0)
+
+#else
+
+#define PROFILING_START(name)           ((void)0)
+#define PROFILING_EVENT(event)          ((void)0)
+#define PROF_Event(event)               (0)
+#define PROFILING_STOP()                ((void)0)
+#define PROFILING_SET_MASK(mask)        ((void)0)
+#define PROFILING_IS_RUNNING()          (0)
+#define PROFILING_SESSION_START(name)   ((PROF_Session_t *)0)
+#define PROFILING_SESSION_EVENT(s, e)   ((void)0)
+#define PROFILING_SESSION_STOP(s)       ((void)0)
+#define PROF_CAT_ON(cat)                (0)
+#define PROFILING_START_CAT(cat, name)  ((void)0)
+#define PROFILING_EVENT_CAT(cat, event) ((void)0)
+#define PROFILING_STOP_CAT(cat)         ((void)0)
+
+__STATIC_INLINE uint8_t PROFILING_GET_EVENTS(const char **profile_name, uint32_t *time, const char **event, uint8_t max)
+{
+  *profile_name = NULL;
+  return 0;
+}
+
+#endif // PROFILING_ENABLE
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif // _PROFILING_H
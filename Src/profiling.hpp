@@ -0,0 +1,218 @@
+/***********************************************************************
+ File Name    : 'profiling.hpp'
+ Title        : PROFILER
+ Description  : Header-only C++17 layer over profiling.h.
+                prof::EventId  - event name with constexpr FNV-1a ID
+                prof::Session<N> - fixed capacity session, N events,
+                                 inline Event(): CYCCNT load and store
+                prof::CSession - the same interface on top of C API
+                                 (PROFILING_START/EVENT/STOP)
+                prof::PoolSession - the same on PROFILING_SESSION_xxx
+                                 handle from static pool
+                prof::ScopedRegion<S> - Start() on construction,
+                                 Stop() and report on scope exit
+                Output format is the one of PROFILING_STOP.
+                With PROFILING_ENABLE == 0 all calls compile to nothing.
+
+                Example:
+                static prof::Session<8> boot("Init");
+                {
+                  prof::ScopedRegion<prof::Session<8>> region(boot);
+                  IO_Init();
+                  PROF_EVENT(boot, "IO_Init()");
+                }
+
+ Target MCU   : STM32
+ Compiler     : GCC / ARM Compiler 6, C++17
+ Editor Tabs  : 2
+***********************************************************************/
+
+#ifndef _PROFILING_HPP
+#define _PROFILING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "profiling.h"
+
+namespace prof {
+
+/**
+ * @brief FNV-1a 32 bit hash, evaluated at compile time for literals
+ */
+constexpr uint32_t Fnv1a(const char *s)
+{
+  uint32_t h = 2166136261u;
+
+  while (*s)
+    h = (h ^ static_cast<uint8_t>(*s++)) * 16777619u;
+  return h;
+}
+
+/**
+ * @brief Event name and its ID. Declare static constexpr, Session
+ *        stores only the pointer
+ */
+struct EventId
+{
+  const char *name;
+  uint32_t   id;
+
+  constexpr explicit EventId(const char *n) : name(n), id(Fnv1a(n)) {}
+};
+
+/**
+ * @brief DWT cycle counter
+ */
+__attribute__((always_inline)) inline uint32_t Cycles()
+{
+  return DWT->CYCCNT;
+}
+
+/**
+ * @brief Session with capacity as template parameter
+ */
+template <std::size_t Capacity>
+class Session
+{
+  static_assert(Capacity > 0 && Capacity <= 255, "Session capacity 1..255");
+
+public:
+  explicit constexpr Session(const char *name) : name_(name) {}
+
+  void Start()
+  {
+    if constexpr (PROFILING_ENABLE)
+    {
+      count_ = 0;
+      PROF_CYCCNT_ENABLE();
+      start_ = Cycles();
+    }
+  }
+
+  __attribute__((always_inline)) void Event(const EventId &ev)
+  {
+    if constexpr (PROFILING_ENABLE)
+    {
+      if (count_ < Capacity)
+      {
+        time_[count_] = Cycles();
+        event_[count_++] = &ev;
+      }
+    }
+  }
+
+  void Stop() { Report(); }
+
+  void Report() const
+  {
+    if constexpr (PROFILING_ENABLE)
+    {
+      int32_t tick_per_1us = SystemCoreClock / 1000000;
+      int32_t time_prev = 0;
+
+      printf("Profiling \"%s\" sequence: \r\n"
+             "--Event-----------------------|--timestamp--|----delta_t---\r\n", name_);
+      for (std::size_t i = 0; i < count_; i++)
+      {
+        int32_t timestamp = (time_[i] - start_) / tick_per_1us;
+        printf("%-30s:%9d us | +%9d us\r\n", event_[i]->name,
+               static_cast<int>(timestamp), static_cast<int>(timestamp - time_prev));
+        time_prev = timestamp;
+      }
+      printf("\r\n");
+    }
+  }
+
+  std::size_t Count() const { return count_; }
+  uint32_t Id(std::size_t i) const { return event_[i]->id; }
+  const char *Name(std::size_t i) const { return event_[i]->name; }
+
+  // cycles from Start() to event i
+  uint32_t Time(std::size_t i) const { return time_[i] - start_; }
+
+  // cycles from Start() to first event with ID, 0 if not recorded
+  uint32_t TimeOf(uint32_t id) const
+  {
+    for (std::size_t i = 0; i < count_; i++)
+    {
+      if (event_[i]->id == id)
+        return time_[i] - start_;
+    }
+    return 0;
+  }
+
+private:
+  const char    *name_;
+  uint32_t      start_ = 0;
+  uint32_t      time_[Capacity] = {};
+  const EventId *event_[Capacity] = {};
+  uint8_t       count_ = 0;
+};
+
+/**
+ * @brief Session interface on top of C API, shares MAX_EVENT_COUNT
+ *        session with PROFILING_xxx calls
+ */
+class CSession
+{
+public:
+  explicit constexpr CSession(const char *name) : name_(name) {}
+
+  void Start() { PROFILING_START(name_); }
+  void Event(const EventId &ev) { PROFILING_EVENT(ev.name); }
+  void Stop() { PROFILING_STOP(); }
+
+private:
+  const char *name_;
+};
+
+/**
+ * @brief Session interface on PROFILING_SESSION_xxx handle, concurrent
+ *        with other sessions. Start() without free pool session and
+ *        following calls do nothing
+ */
+class PoolSession
+{
+public:
+  explicit constexpr PoolSession(const char *name) : name_(name) {}
+
+  void Start() { handle_ = PROFILING_SESSION_START(name_); }
+  void Event(const EventId &ev) { PROFILING_SESSION_EVENT(handle_, ev.name); }
+  void Stop() { PROFILING_SESSION_STOP(handle_); handle_ = nullptr; }
+
+private:
+  const char     *name_;
+  PROF_Session_t *handle_ = nullptr;
+};
+
+/**
+ * @brief Start session on construction, stop and report on scope exit
+ */
+template <class S>
+class ScopedRegion
+{
+public:
+  explicit ScopedRegion(S &session) : session_(session) { session_.Start(); }
+  ~ScopedRegion() { session_.Stop(); }
+
+  ScopedRegion(const ScopedRegion &) = delete;
+  ScopedRegion &operator=(const ScopedRegion &) = delete;
+
+private:
+  S &session_;
+};
+
+} // namespace prof
+
+// event with name literal, ID computed at compile time
+#define PROF_EVENT(session, name)                                   \
+  do {                                                              \
+    static constexpr ::prof::EventId prof_event_(name);             \
+    (session).Event(prof_event_);                                   \
+  } while (0)
+
+// compile time ID of name literal, usable as case label
+#define PROF_ID(name)   (std::integral_constant<uint32_t, ::prof::Fnv1a(name)>::value)
+
+#endif // _PROFILING_HPP
@@ -0,0 +1,286 @@
+/***********************************************************************
+ File Name    : 'profiling_bench.c'
+ Title        : PROFILER
+ Description  : Microbenchmark harness on DWT_CYCCNT.
+                For every benchmark and prefetch state:
+                1. iterations per batch doubled until the batch takes
+                   PROFILING_BENCH_MIN_MS
+                2. warm-up batch, then PROFILING_BENCH_SAMPLES batches
+                3. batches outside median +- 3 * 1.4826 * MAD dropped
+                4. cost of calling empty function subtracted
+                Output is CSV, collected by Tools/bench_compare.py:
+                BENCH-BEGIN,<format>,<core clock>,<build>
+                BENCH,<name>,<prefetch>,<wait states>,<iters>,<kept>,<cycles/iter>,<stddev>,<min>
+                BENCH-END,<benchmarks>
+
+                Examle output:
+                BENCH-BEGIN,1,72000000,Oct 18 2026 12:00:00
+                BENCH,memcpy 64,1,2,8192,15,92.31,0.04,92.25
+                BENCH,memcpy 64,0,2,8192,14,118.02,0.11,117.88
+                BENCH-END,1
+
+ Target MCU   : STM32F30x
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_bench.h"
+#include <math.h>
+
+#if PROFILING_BENCH
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+#define BENCH_FORMAT    1
+#define BENCH_MAX_ITERS (1u << 24)
+
+typedef struct
+{
+  const char    *name;
+  PROF_BENCH_Fn fn;
+  void          *arg;
+  uint8_t       flags;
+} bench_t;
+
+/* Private variables -------------------------------------------------*/
+static bench_t  bench[PROFILING_BENCH_MAX];
+static uint8_t  bench_count;
+static uint32_t sample[PROFILING_BENCH_SAMPLES];
+static void * volatile bench_sink;
+
+/* Private function prototypes ---------------------------------------*/
+static void     bench_empty(void *arg);
+static uint32_t bench_batch(PROF_BENCH_Fn fn, void *arg, uint32_t iters, uint8_t noirq);
+static void     bench_stats(PROF_BENCH_Fn fn, void *arg, uint8_t flags, uint32_t iters, PROF_BENCH_Result_t *r);
+static void     bench_sort(uint32_t *v, int n);
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Call overhead reference
+ */
+static void bench_empty(void *arg)
+{
+  bench_sink = arg;
+}
+
+
+/**
+ * @brief Time one batch
+ *
+ * @return Cycles of iters calls
+ */
+static uint32_t bench_batch(PROF_BENCH_Fn fn, void *arg, uint32_t iters, uint8_t noirq)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t t0;
+
+  if (noirq)
+    __disable_irq();
+  t0 = DWT->CYCCNT;
+  for (uint32_t i = 0; i < iters; i++)
+    fn(arg);
+  t0 = DWT->CYCCNT - t0;
+  if (noirq && !primask)
+    __enable_irq();
+  return t0;
+}
+
+
+/**
+ * @brief Insertion sort, PROFILING_BENCH_SAMPLES values
+ */
+static void bench_sort(uint32_t *v, int n)
+{
+  for (int i = 1; i < n; i++)
+  {
+    uint32_t x = v[i];
+    int j;
+    for (j = i; j > 0 && v[j - 1] > x; j--)
+      v[j] = v[j - 1];
+    v[j] = x;
+  }
+}
+
+
+/**
+ * @brief Warm-up, sample batches, reject outliers. Cycles per batch
+ */
+static void bench_stats(PROF_BENCH_Fn fn, void *arg, uint8_t flags, uint32_t iters, PROF_BENCH_Result_t *r)
+{
+  uint32_t dev[PROFILING_BENCH_SAMPLES];
+  uint32_t median, mad, limit;
+  float sum = 0, sum2 = 0;  // of differences to median, keeps float precision
+  int kept = 0;
+  int i;
+
+  bench_batch(fn, arg, iters, flags & PROF_BENCH_NOIRQ);
+  for (i = 0; i < PROFILING_BENCH_SAMPLES; i++)
+    sample[i] = bench_batch(fn, arg, iters, flags & PROF_BENCH_NOIRQ);
+
+  bench_sort(sample, PROFILING_BENCH_SAMPLES);
+  median = sample[PROFILING_BENCH_SAMPLES / 2];
+  for (i = 0; i < PROFILING_BENCH_SAMPLES; i++)
+    dev[i] = (sample[i] > median) ? sample[i] - median : median - sample[i];
+  bench_sort(dev, PROFILING_BENCH_SAMPLES);
+  mad = dev[PROFILING_BENCH_SAMPLES / 2];
+  limit = (mad * 1483 * 3) / 1000 + 1; // 3 sigma, 1.4826 * MAD
+
+  for (i = 0; i < PROFILING_BENCH_SAMPLES; i++)
+  {
+    uint32_t d = (sample[i] > median) ? sample[i] - median : median - sample[i];
+    if (d > limit)
+      continue;
+    sum += (float)(int32_t)(sample[i] - median);
+    sum2 += (float)d * d;
+    kept++;
+  }
+
+  r->cycles = median + sum / kept;
+  r->stddev = (kept > 1) ? sqrtf((sum2 - sum * sum / kept) / (kept - 1)) : 0;
+  r->min = sample[0];
+  r->samples = kept;
+}
+
+
+/**
+ * @brief Measure one function in prefetch state of flags
+ *
+ * @param fn     Benchmark, one iteration
+ * @param arg    Benchmark argument
+ * @param flags  PROF_BENCH_PREFETCH_ON or _OFF (else unchanged), PROF_BENCH_NOIRQ
+ * @param result Per iteration result
+ */
+void PROF_BENCH_Measure(PROF_BENCH_Fn fn, void *arg, uint8_t flags, PROF_BENCH_Result_t *result)
+{
+  PROF_BENCH_Result_t empty;
+  uint32_t min_cycles = SystemCoreClock / 1000 * PROFILING_BENCH_MIN_MS;
+  uint32_t acr = FLASH->ACR;
+  uint32_t iters;
+  uint32_t t;
+
+  PROF_CYCCNT_ENABLE();
+  if (flags & PROF_BENCH_PREFETCH_OFF)
+    FLASH_PrefetchBufferCmd(DISABLE);
+  else if (flags & PROF_BENCH_PREFETCH_ON)
+    FLASH_PrefetchBufferCmd(ENABLE);
+
+  // batch long enough for CYCCNT resolution and interrupt noise
+  for (iters = 1; iters < BENCH_MAX_ITERS; iters *= 2)
+  {
+    t = bench_batch(fn, arg, iters, flags & PROF_BENCH_NOIRQ);
+    if (t >= min_cycles)
+      break;
+  }
+
+  bench_stats(fn, arg, flags, iters, result);
+  bench_stats(bench_empty, arg, flags, iters, &empty);
+
+  result->cycles = (result->cycles - empty.cycles) / iters;
+  result->stddev = result->stddev / iters;
+  result->min = (result->min - empty.min) / iters;
+  result->iters = iters;
+  result->prefetch = (FLASH->ACR & FLASH_ACR_PRFTBS) ? 1 : 0;
+  result->latency = FLASH->ACR & FLASH_ACR_LATENCY;
+
+  FLASH_PrefetchBufferCmd((acr & FLASH_ACR_PRFTBE) ? ENABLE : DISABLE);
+}
+
+
+/**
+ * @brief Print result as BENCH CSV line
+ */
+void PROF_BENCH_Print(const char *name, const PROF_BENCH_Result_t *result)
+{
+  DEBUG_PRINTF("BENCH,%s,%u,%u,%u,%u,%.2f,%.2f,%.2f\r\n", name,
+               (unsigned)result->prefetch, (unsigned)result->latency,
+               (unsigned)result->iters, (unsigned)result->samples,
+               result->cycles, result->stddev, result->min);
+}
+
+
+/**
+ * @brief Register benchmark for PROF_BENCH_Run()
+ *
+ * @param name  Benchmark name, no commas
+ * @param fn    Benchmark, one iteration
+ * @param arg   Benchmark argument
+ * @param flags PROF_BENCH_xxx, both prefetch flags - run twice
+ */
+void PROF_BENCH_Add(const char *name, PROF_BENCH_Fn fn, void *arg, uint8_t flags)
+{
+  if (bench_count >= PROFILING_BENCH_MAX)
+    return;
+
+  bench[bench_count].name = name;
+  bench[bench_count].fn = fn;
+  bench[bench_count].arg = arg;
+  bench[bench_count].flags = flags;
+  bench_count++;
+}
+
+
+/**
+ * @brief Registered benchmark by index
+ *
+ * @return Benchmark name, NULL if index out of range
+ */
+const char *PROF_BENCH_Get(int index, PROF_BENCH_Fn *fn, void **arg)
+{
+  if (index < 0 || index >= bench_count)
+    return NULL;
+
+  *fn = bench[index].fn;
+  *arg = bench[index].arg;
+  return bench[index].name;
+}
+
+
+/**
+ * @brief Print CSV header, before PROF_BENCH_Print() lines
+ */
+void PROF_BENCH_Begin(void)
+{
+  DEBUG_PRINTF("BENCH-BEGIN,%d,%u,%s %s\r\n", BENCH_FORMAT, (unsigned)SystemCoreClock, __DATE__, __TIME__);
+}
+
+
+/**
+ * @brief Print CSV trailer
+ *
+ * @param count Number of benchmarks
+ */
+void PROF_BENCH_End(int count)
+{
+  DEBUG_PRINTF("BENCH-END,%d\r\n", count);
+}
+
+
+/**
+ * @brief Run all registered benchmarks, print CSV to ITM Stimulus Port 0
+ */
+void PROF_BENCH_Run(void)
+{
+  PROF_BENCH_Result_t r;
+  uint8_t flags;
+
+  PROF_BENCH_Begin();
+  for (int i = 0; i < bench_count; i++)
+  {
+    flags = bench[i].flags;
+    if (!(flags & PROF_BENCH_PREFETCH_OFF) || (flags & PROF_BENCH_PREFETCH_ON))
+    {
+      PROF_BENCH_Measure(bench[i].fn, bench[i].arg, flags & ~PROF_BENCH_PREFETCH_OFF, &r);
+      PROF_BENCH_Print(bench[i].name, &r);
+    }
+    if (flags & PROF_BENCH_PREFETCH_OFF)
+    {
+      PROF_BENCH_Measure(bench[i].fn, bench[i].arg, flags & ~PROF_BENCH_PREFETCH_ON, &r);
+      PROF_BENCH_Print(bench[i].name, &r);
+    }
+  }
+  PROF_BENCH_End(bench_count);
+}
+
+#endif // PROFILING_BENCH
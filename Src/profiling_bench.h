@@ -0,0 +1,48 @@
+#ifndef _PROFILING_BENCH_H
+#define _PROFILING_BENCH_H
+
+#include "profiling.h"
+
+/**
+ * Microbenchmark harness.
+ * Benchmark function runs one iteration. Iteration count is doubled
+ * until one batch takes PROFILING_BENCH_MIN_MS, then after warm-up
+ * PROFILING_BENCH_SAMPLES batches are timed, outliers (median +- 3 MAD)
+ * dropped and call overhead of empty function subtracted.
+ * PROF_BENCH_Run() prints CSV lines for Tools/bench_compare.py.
+ */
+#if PROFILING_BENCH
+
+#define PROF_BENCH_PREFETCH_ON  0x01  // run with flash prefetch buffer on
+#define PROF_BENCH_PREFETCH_OFF 0x02  // run with flash prefetch buffer off
+#define PROF_BENCH_NOIRQ        0x04  // mask interrupts during batch
+
+typedef void (*PROF_BENCH_Fn)(void *arg);
+
+typedef struct
+{
+  float    cycles;    // per iteration, overhead subtracted
+  float    stddev;    // per iteration
+  float    min;       // per iteration, fastest batch
+  uint32_t iters;     // iterations per batch
+  uint8_t  samples;   // batches kept after outlier rejection
+  uint8_t  prefetch;  // flash prefetch buffer state during run
+  uint8_t  latency;   // flash wait states during run
+} PROF_BENCH_Result_t;
+
+void PROF_BENCH_Add(const char *name, PROF_BENCH_Fn fn, void *arg, uint8_t flags);
+void PROF_BENCH_Measure(PROF_BENCH_Fn fn, void *arg, uint8_t flags, PROF_BENCH_Result_t *result);
+void PROF_BENCH_Print(const char *name, const PROF_BENCH_Result_t *result);
+const char *PROF_BENCH_Get(int index, PROF_BENCH_Fn *fn, void **arg);
+void PROF_BENCH_Begin(void);
+void PROF_BENCH_End(int count);
+void PROF_BENCH_Run(void);
+
+#else
+
+#define PROF_BENCH_Add(n, f, a, fl) ((void)0)
+#define PROF_BENCH_Run()            ((void)0)
+
+#endif // PROFILING_BENCH
+
+#endif // _PROFILING_BENCH_H
@@ -0,0 +1,245 @@
+/***********************************************************************
+ File Name    : 'profiling_bkp.c'
+ Title        : PROFILER
+ Description  : Cross-reset statistics in RTC backup registers.
+                DR0        : magic | resets counter
+                DR1        : checksum of DR0, DR2..
+                DR2 + 3*n  : name hash | count (saturated) of slot n
+                DR3 + 3*n  : max delta_t, cycles
+                DR4 + 3*n  : min delta_t, cycles
+                Event is matched by name pointer, stored by name hash,
+                so slots are found again after reset.
+
+                Examle output:
+                Statistics since 3 resets (last reset: IWDG):
+                --Event-----------------------|---count--|-----min-----|-----max-----
+                Wait for update Tick          :     5210 |       12 us |      998 us
+
+ Target MCU   : STM32F30x
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_bkp.h"
+
+#if PROFILING_BKP_STATS
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+
+#define BKP_MAGIC     0x50420000  // "PB"
+#define BKP_REGS      (2 + 3 * PROFILING_BKP_SLOTS)
+
+#if BKP_REGS > 16
+#error "PROFILING_BKP_SLOTS too big, 16 backup registers only"
+#endif
+
+typedef struct
+{
+  const char *name;
+  uint16_t   hash;
+  uint16_t   count;
+  uint32_t   max;
+  uint32_t   min;
+} bkp_slot_t;
+
+/* Private variables -------------------------------------------------*/
+static bkp_slot_t slot[PROFILING_BKP_SLOTS];
+static uint8_t    resets;
+static uint8_t    reported;
+static const char *reset_cause;
+
+/* Private function prototypes ---------------------------------------*/
+static uint16_t bkp_hash(const char *s);
+static uint32_t bkp_checksum(const uint32_t *dr);
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief FNV-1a folded to 16 bit
+ */
+static uint16_t bkp_hash(const char *s)
+{
+  uint32_t h = 2166136261u;
+
+  while (*s)
+    h = (h ^ (uint8_t)*s++) * 16777619u;
+  return (uint16_t)(h ^ (h >> 16));
+}
+
+
+static uint32_t bkp_checksum(const uint32_t *dr)
+{
+  uint32_t sum = 0x5A5A5A5A;
+
+  for (int i = 0; i < BKP_REGS; i++)
+  {
+    if (i != 1)
+      sum = ((sum << 5) | (sum >> 27)) ^ dr[i];
+  }
+  return ~sum;
+}
+
+
+/**
+ * @brief Enable backup domain access, load saved statistic. Call once on boot
+ */
+void PROF_BKP_Init(void)
+{
+  uint32_t dr[BKP_REGS];
+
+  RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR, ENABLE);
+  PWR_BackupAccessCmd(ENABLE);
+
+  if (RCC_GetFlagStatus(RCC_FLAG_IWDGRST))
+    reset_cause = "IWDG";
+  else if (RCC_GetFlagStatus(RCC_FLAG_WWDGRST))
+    reset_cause = "WWDG";
+  else if (RCC_GetFlagStatus(RCC_FLAG_SFTRST))
+    reset_cause = "software";
+  else if (RCC_GetFlagStatus(RCC_FLAG_PORRST))
+    reset_cause = "power on";
+  else
+    reset_cause = "pin";
+  // flags are sticky, next reset would report this cause again
+  RCC_ClearFlag();
+
+  for (int i = 0; i < BKP_REGS; i++)
+    dr[i] = RTC_ReadBackupRegister(RTC_BKP_DR0 + i);
+
+  if ((dr[0] & 0xFFFF0000) != BKP_MAGIC || dr[1] != bkp_checksum(dr))
+  {
+    PROF_BKP_Clear();
+    return;
+  }
+
+  resets = (uint8_t)dr[0];
+  if (resets < 0xFF)
+    resets++;
+  for (int i = 0; i < PROFILING_BKP_SLOTS; i++)
+  {
+    slot[i].hash  = dr[2 + 3 * i] >> 16;
+    slot[i].count = (uint16_t)dr[2 + 3 * i];
+    slot[i].max   = dr[3 + 3 * i];
+    slot[i].min   = dr[4 + 3 * i];
+  }
+  PROF_BKP_Save();
+}
+
+
+/**
+ * @brief Select event for statistic. Saved values are kept if name is same
+ *
+ * @param n     Slot number
+ * @param event Event name, same pointer as in PROFILING_EVENT()
+ */
+void PROF_BKP_Track(uint8_t n, const char *event)
+{
+  uint16_t hash = bkp_hash(event);
+
+  if (n >= PROFILING_BKP_SLOTS)
+    return;
+
+  slot[n].name = event;
+  if (slot[n].hash != hash)
+  {
+    slot[n].hash = hash;
+    slot[n].count = 0;
+    slot[n].max = 0;
+    slot[n].min = 0xFFFFFFFF;
+  }
+}
+
+
+/**
+ * @brief Update statistic. Called from PROFILING_EVENT
+ *
+ * @param event Event name
+ * @param delta Cycles from previous event
+ */
+void PROF_BKP_Event(const char *event, uint32_t delta)
+{
+  for (int i = 0; i < PROFILING_BKP_SLOTS; i++)
+  {
+    if (slot[i].name != event)
+      continue;
+
+    if (slot[i].count < 0xFFFF)
+      slot[i].count++;
+    if (delta > slot[i].max)
+      slot[i].max = delta;
+    if (delta < slot[i].min)
+      slot[i].min = delta;
+    return;
+  }
+}
+
+
+/**
+ * @brief Write statistic to backup registers. Called from PROFILING_STOP
+ */
+void PROF_BKP_Save(void)
+{
+  uint32_t dr[BKP_REGS];
+
+  dr[0] = BKP_MAGIC | resets;
+  for (int i = 0; i < PROFILING_BKP_SLOTS; i++)
+  {
+    dr[2 + 3 * i] = ((uint32_t)slot[i].hash << 16) | slot[i].count;
+    dr[3 + 3 * i] = slot[i].max;
+    dr[4 + 3 * i] = slot[i].min;
+  }
+  dr[1] = bkp_checksum(dr);
+
+  for (int i = 0; i < BKP_REGS; i++)
+    RTC_WriteBackupRegister(RTC_BKP_DR0 + i, dr[i]);
+}
+
+
+/**
+ * @brief Print statistic once, by first PROFILING_STOP after boot
+ */
+void PROF_BKP_Report(void)
+{
+  uint32_t tick_per_1us = SystemCoreClock / 1000000;
+
+  if (reported)
+    return;
+  reported = 1;
+
+  DEBUG_PRINTF("Statistics since %u resets (last reset: %s):\r\n"
+               "--Event-----------------------|---count--|-----min-----|-----max-----\r\n",
+               resets, reset_cause);
+  for (int i = 0; i < PROFILING_BKP_SLOTS; i++)
+  {
+    if (!slot[i].count)
+      continue;
+    if (slot[i].name && slot[i].hash == bkp_hash(slot[i].name))
+      DEBUG_PRINTF("%-30s:", slot[i].name);
+    else
+      DEBUG_PRINTF("hash 0x%04X                   :", slot[i].hash);
+    DEBUG_PRINTF(" %8u | %8u us | %8u us\r\n", (unsigned)slot[i].count,
+                 (unsigned)(slot[i].min / tick_per_1us), (unsigned)(slot[i].max / tick_per_1us));
+  }
+  DEBUG_PRINTF("\r\n");
+}
+
+
+/**
+ * @brief Clear statistic and resets counter
+ */
+void PROF_BKP_Clear(void)
+{
+  resets = 0;
+  for (int i = 0; i < PROFILING_BKP_SLOTS; i++)
+  {
+    slot[i].hash = slot[i].name ? bkp_hash(slot[i].name) : 0;
+    slot[i].count = 0;
+    slot[i].max = 0;
+    slot[i].min = 0xFFFFFFFF;
+  }
+  PROF_BKP_Save();
+}
+
+#endif // PROFILING_BKP_STATS
@@ -0,0 +1,33 @@
+#ifndef _PROFILING_BKP_H
+#define _PROFILING_BKP_H
+
+#include "profiling.h"
+
+/**
+ * Cross-reset statistics.
+ * min/max/count of delta_t for events selected by PROF_BKP_Track() are
+ * kept in RTC backup registers with checksum. They survive watchdog and
+ * software resets and are printed by first PROFILING_STOP after boot.
+ * Registers are updated by PROFILING_STOP, outside of profiled code.
+ */
+#if PROFILING_BKP_STATS
+
+void PROF_BKP_Init(void);
+void PROF_BKP_Track(uint8_t slot, const char *event);
+void PROF_BKP_Event(const char *event, uint32_t delta);
+void PROF_BKP_Save(void);
+void PROF_BKP_Report(void);
+void PROF_BKP_Clear(void);
+
+#else
+
+#define PROF_BKP_Init()         ((void)0)
+#define PROF_BKP_Track(s, e)    ((void)0)
+#define PROF_BKP_Event(e, d)    ((void)0)
+#define PROF_BKP_Save()         ((void)0)
+#define PROF_BKP_Report()       ((void)0)
+#define PROF_BKP_Clear()        ((void)0)
+
+#endif // PROFILING_BKP_STATS
+
+#endif // _PROFILING_BKP_H
@@ -0,0 +1,152 @@
+/***********************************************************************
+ File Name    : 'profiling_boot.c'
+ Title        : PROFILER
+ Description  : Boot time profiling.
+                PROF_BOOT_Reset() and PROF_BOOT_SystemInit() are called
+                from Reset_Handler (startup_stm32f303xc.s) before C
+                runtime init, so they use only no-init data. $Sub$$main
+                marks the end of __main (scatter loading, zero init),
+                PROF_BOOT_Main() the same in GCC startup.
+                Core runs on HSI until SystemInit() switches to PLL:
+                cycles before PROF_BOOT_SystemInit() are counted at
+                HSI_VALUE, session start is moved back so that later
+                events converted at SystemCoreClock stay correct.
+
+                Examle output (first session):
+                Profiling "MAIN startup timing" sequence:
+                --Event-----------------------|--timestamp--|----delta_t---
+                Reset_Handler                 :        0 us | +        0 us
+                SystemInit                    :      952 us | +      952 us
+                __main                        :      958 us | +        6 us
+                IO_Init()                     :      967 us | +        9 us
+
+ Target MCU   : STM32
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_boot.h"
+
+#if PROFILING_BOOT
+
+/* Private Definitions -----------------------------------------------*/
+#define BOOT_MAGIC  0xB0070000
+
+typedef struct
+{
+  uint32_t    magic;   // BOOT_MAGIC | count, marks not taken yet
+  uint32_t    pll;     // CYCCNT at end of SystemInit, HSI clock before
+  uint32_t    time[PROFILING_BOOT_MARKS];
+  const char *name[PROFILING_BOOT_MARKS];
+} boot_marks_t;
+
+/* Private variables -------------------------------------------------*/
+static boot_marks_t boot PROF_NOINIT;
+
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief First code after reset. Start cycle counter from 0
+ */
+void PROF_BOOT_Reset(void)
+{
+  PROF_CYCCNT_ENABLE();
+  DWT->CYCCNT = 0;
+  boot.pll = 0;
+  boot.magic = BOOT_MAGIC;
+  PROF_BOOT_Mark("Reset_Handler");
+}
+
+
+/**
+ * @brief Called after SystemInit() (PLL lock, flash latency)
+ */
+void PROF_BOOT_SystemInit(void)
+{
+  boot.pll = DWT->CYCCNT;
+  PROF_BOOT_Mark("SystemInit");
+}
+
+
+#if defined(__CC_ARM)
+/**
+ * @brief main() wrapper (armlink $Sub$$ patch), called after __main
+ */
+extern int $Super$$main(void);
+
+int $Sub$$main(void)
+{
+  PROF_BOOT_Mark("__main");
+  return $Super$$main();
+}
+#else
+/**
+ * @brief Called by GCC Reset_Handler after C runtime init, before main()
+ */
+void PROF_BOOT_Main(void)
+{
+  PROF_BOOT_Mark("__libc_init_array");
+}
+#endif
+
+
+/**
+ * @brief Add boot phase. Ignored after marks are taken by first session
+ *
+ * @param name Phase name
+ */
+void PROF_BOOT_Mark(const char *name)
+{
+  uint32_t time = DWT->CYCCNT;
+  uint32_t count = boot.magic & 0xFFFF;
+
+  if ((boot.magic & 0xFFFF0000) != BOOT_MAGIC || count >= PROFILING_BOOT_MARKS)
+    return;
+
+  boot.time[count] = time;
+  boot.name[count] = name;
+  boot.magic = BOOT_MAGIC | (count + 1);
+}
+
+
+/**
+ * @brief Move boot phases to session. Called from PROFILING_START
+ *
+ * @param start Session start, reset time in SystemCoreClock cycles
+ *              (before 0 by HSI part stretched to SystemCoreClock)
+ * @param time  Event times, cycles
+ * @param name  Event names
+ * @param max   Size of time[] and name[]
+ *
+ * @return Number of phases, 0 if already taken (start not written)
+ */
+uint8_t PROF_BOOT_Take(uint32_t *start, uint32_t *time, const char **name, uint8_t max)
+{
+  uint32_t pll;
+  uint8_t count;
+
+  if ((boot.magic & 0xFFFF0000) != BOOT_MAGIC)
+    return 0;
+
+  // HSI cycles before PLL switch in SystemCoreClock cycles
+  pll = (uint32_t)((uint64_t)boot.pll * SystemCoreClock / HSI_VALUE);
+  *start = boot.pll - pll;
+
+  count = boot.magic & 0xFFFF;
+  if (count > max)
+    count = max;
+  for (int i = 0; i < count; i++)
+  {
+    if (boot.time[i] < boot.pll)
+      time[i] = *start + (uint32_t)((uint64_t)boot.time[i] * SystemCoreClock / HSI_VALUE);
+    else
+      time[i] = boot.time[i];
+    name[i] = boot.name[i];
+  }
+  boot.magic = 0;
+  return count;
+}
+
+#endif // PROFILING_BOOT
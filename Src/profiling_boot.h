@@ -0,0 +1,28 @@
+#ifndef _PROFILING_BOOT_H
+#define _PROFILING_BOOT_H
+
+#include "profiling.h"
+
+/**
+ * Boot time profiling.
+ * Reset_Handler starts DWT_CYCCNT from 0 before SystemInit, boot phases
+ * are kept in no-init RAM (C runtime init does not clear them) and
+ * become first events of first PROFILING_START session, with time
+ * counted from reset. Phases before PLL switch are timed at HSI_VALUE.
+ */
+#if PROFILING_BOOT
+
+void    PROF_BOOT_Reset(void);
+void    PROF_BOOT_SystemInit(void);
+void    PROF_BOOT_Main(void);
+void    PROF_BOOT_Mark(const char *name);
+uint8_t PROF_BOOT_Take(uint32_t *start, uint32_t *time, const char **name, uint8_t max);
+
+#else
+
+#define PROF_BOOT_Mark(n)       ((void)0)
+#define PROF_BOOT_Take(s, t, n, m) (0)
+
+#endif // PROFILING_BOOT
+
+#endif // _PROFILING_BOOT_H
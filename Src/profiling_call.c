@@ -0,0 +1,452 @@
+/***********************************************************************
+ File Name    : 'profiling_call.c'
+ Title        : PROFILER
+ Description  : Call graph profiler (gprof like).
+                __cyg_profile_func_enter() only pushes function address
+                and DWT_CYCCNT to shadow stack. __cyg_profile_func_exit()
+                pops the frame, adds its inclusive time to callees of
+                parent frame and writes caller, function, inclusive and
+                exclusive (inclusive - callees) time to a record ring.
+                Both hooks run with interrupts masked, no hashing in them.
+                When the ring is half full the exit hook adds a quarter
+                of it to open addressing hash tables of functions and
+                caller->callee edges, its time is removed from the open
+                frames. Calls beyond table size or stack depth are lost
+                and reported. Interrupt handlers nest on the same stack:
+                frame entered in other exception (IPSR) than the frame
+                below is a root with caller 0, its time is removed from
+                all interrupted frames.
+                Hook cost is one enter/exit pair, table cost is average
+                of the real table updates of the session.
+                Addresses are resolved with arm-none-eabi-addr2line -f.
+
+                Examle output:
+                Call graph: 3 functions, 3 edges, depth 4, hook 16 cycles, table 52 cycles/call
+                --Function----|---calls--|--exclusive--|--inclusive--
+                0x08000A1D    :     1000 |      120345 |      240120
+                0x08000B01    :        1 |      119775 |      359895
+                --Caller------|--Callee------|---calls--
+                0x08000B01    : 0x08000A1D   |     1000
+
+ Target MCU   : STM32
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_call.h"
+
+#if PROFILING_CALL_GRAPH
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+
+#if (PROFILING_CALL_FUNCS & (PROFILING_CALL_FUNCS - 1)) || (PROFILING_CALL_EDGES & (PROFILING_CALL_EDGES - 1)) || \
+    (PROFILING_CALL_RING & (PROFILING_CALL_RING - 1)) || PROFILING_CALL_RING < 4
+#error "PROFILING_CALL_FUNCS, PROFILING_CALL_EDGES and PROFILING_CALL_RING must be power of 2"
+#endif
+
+#define RING_MASK       (PROFILING_CALL_RING - 1)
+
+#if defined(__CC_ARM)
+#define NO_INSTRUMENT   // file compiled without --gnu_instrument
+#else
+#define NO_INSTRUMENT   __attribute__((no_instrument_function))
+#endif
+
+// Fibonacci hash, thumb bit dropped
+#define CALL_HASH(a)    ((((uint32_t)(a) >> 1) * 2654435761u) >> 16)
+
+typedef struct
+{
+  uint32_t fn;        // function address
+  uint32_t start;     // entry time
+  uint32_t callees;   // inclusive cycles of callees
+  uint32_t ipsr;      // active exception at entry, 0 - thread mode
+} call_frame_t;
+
+typedef struct
+{
+  uint32_t caller;    // 0 - stack root
+  uint32_t fn;
+  uint32_t incl;
+  uint32_t excl;
+} call_rec_t;
+
+typedef struct
+{
+  uint32_t fn;        // function address, 0 - free slot
+  uint32_t calls;
+  uint64_t excl;
+  uint64_t incl;
+} call_func_t;
+
+typedef struct
+{
+  uint32_t caller;    // 0 - stack root
+  uint32_t callee;    // 0 - free slot
+  uint32_t calls;
+} call_edge_t;
+
+/* Private variables -------------------------------------------------*/
+static call_frame_t call_stack[PROFILING_CALL_DEPTH];
+static uint32_t     call_depth;     // may exceed PROFILING_CALL_DEPTH
+static uint32_t     call_max_depth;
+static uint32_t     call_lost;      // calls not counted
+static uint32_t     call_hook;      // enter + exit cycles
+static call_rec_t   call_ring[PROFILING_CALL_RING];
+static uint32_t     call_head;      // next exit record, free running
+static uint32_t     call_tail;      // next record for tables, free running
+static uint32_t     call_table_cyc; // cycles of table updates
+static uint32_t     call_table_n;   // records added to tables
+static call_func_t  call_func[PROFILING_CALL_FUNCS];
+static call_edge_t  call_edge[PROFILING_CALL_EDGES];
+
+/* Private function prototypes ---------------------------------------*/
+void __cyg_profile_func_enter(void *fn, void *site) NO_INSTRUMENT;
+void __cyg_profile_func_exit(void *fn, void *site) NO_INSTRUMENT;
+static void call_add(const call_rec_t *r) NO_INSTRUMENT;
+static uint32_t call_drain(uint32_t n) NO_INSTRUMENT;
+static void call_clear(void) NO_INSTRUMENT;
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Function entry hook. Push frame
+ */
+void __cyg_profile_func_enter(void *fn, void *site)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t d;
+
+  __disable_irq();
+  d = call_depth;
+  if (d < PROFILING_CALL_DEPTH)
+  {
+    call_stack[d].fn = (uint32_t)(uintptr_t)fn;
+    call_stack[d].callees = 0;
+    call_stack[d].ipsr = __get_IPSR();
+    call_stack[d].start = DWT->CYCCNT;
+  }
+  call_depth = d + 1;
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Function exit hook. Pop frame to record ring
+ */
+void __cyg_profile_func_exit(void *fn, void *site)
+{
+  uint32_t now = DWT->CYCCNT;
+  uint32_t primask = __get_PRIMASK();
+  uint32_t d, t;
+  call_rec_t *r;
+
+  __disable_irq();
+  d = call_depth;
+  if (d == 0)
+  {
+    // entered before reset of tables
+    if (!primask)
+      __enable_irq();
+    return;
+  }
+
+  // frame read before depth is published
+  if (--d < PROFILING_CALL_DEPTH)
+  {
+    r = &call_ring[call_head++ & RING_MASK];
+    r->fn = call_stack[d].fn;
+    r->incl = now - call_stack[d].start;
+    r->excl = r->incl - call_stack[d].callees;
+    r->caller = 0;
+    if (d > 0 && call_stack[d].ipsr == call_stack[d - 1].ipsr)
+    {
+      r->caller = call_stack[d - 1].fn;
+      call_stack[d - 1].callees += r->incl;
+    }
+    else
+    {
+      // interrupt handler root is not time of interrupted frames
+      for (uint32_t i = 0; i < d; i++)
+        call_stack[i].start += r->incl;
+    }
+    if (d >= call_max_depth)
+      call_max_depth = d + 1;
+  }
+  else
+  {
+    call_lost++;
+  }
+  call_depth = d;
+
+  if (call_head - call_tail >= PROFILING_CALL_RING / 2)
+  {
+    // table update is not time of any open frame
+    t = call_drain(PROFILING_CALL_RING / 4);
+    for (uint32_t i = 0; i < d && i < PROFILING_CALL_DEPTH; i++)
+      call_stack[i].start += t;
+  }
+
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Add call record to function and edge tables. Interrupts masked
+ */
+static void call_add(const call_rec_t *r)
+{
+  uint32_t i;
+  int n;
+
+  i = CALL_HASH(r->fn) & (PROFILING_CALL_FUNCS - 1);
+  for (n = 0; n < PROFILING_CALL_FUNCS; n++)
+  {
+    if (call_func[i].fn == r->fn || call_func[i].fn == 0)
+      break;
+    i = (i + 1) & (PROFILING_CALL_FUNCS - 1);
+  }
+  if (n < PROFILING_CALL_FUNCS)
+  {
+    call_func[i].fn = r->fn;
+    call_func[i].calls++;
+    call_func[i].incl += r->incl;
+    call_func[i].excl += r->excl;
+  }
+  else
+  {
+    call_lost++;
+  }
+
+  i = CALL_HASH(r->fn ^ (r->caller << 7)) & (PROFILING_CALL_EDGES - 1);
+  for (n = 0; n < PROFILING_CALL_EDGES; n++)
+  {
+    if ((call_edge[i].callee == r->fn && call_edge[i].caller == r->caller) || call_edge[i].callee == 0)
+      break;
+    i = (i + 1) & (PROFILING_CALL_EDGES - 1);
+  }
+  if (n < PROFILING_CALL_EDGES)
+  {
+    call_edge[i].caller = r->caller;
+    call_edge[i].callee = r->fn;
+    call_edge[i].calls++;
+  }
+}
+
+
+/**
+ * @brief Add up to n oldest records of ring to tables. Interrupts masked
+ *
+ * @return Cycles spent
+ */
+static uint32_t call_drain(uint32_t n)
+{
+  uint32_t t0 = DWT->CYCCNT;
+
+  for (; n && call_tail != call_head; n--)
+  {
+    call_add(&call_ring[call_tail++ & RING_MASK]);
+    call_table_n++;
+  }
+  t0 = DWT->CYCCNT - t0;
+  call_table_cyc += t0;
+  return t0;
+}
+
+
+/**
+ * @brief Clear function and edge tables and record ring
+ */
+static void call_clear(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  for (int i = 0; i < PROFILING_CALL_FUNCS; i++)
+  {
+    call_func[i].fn = 0;
+    call_func[i].calls = 0;
+    call_func[i].excl = 0;
+    call_func[i].incl = 0;
+  }
+  for (int i = 0; i < PROFILING_CALL_EDGES; i++)
+  {
+    call_edge[i].callee = 0;
+    call_edge[i].calls = 0;
+  }
+  call_tail = call_head;
+  call_table_cyc = 0;
+  call_table_n = 0;
+  call_max_depth = 0;
+  call_lost = 0;
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Clear statistic, measure hook cost. Called from PROFILING_START
+ */
+void PROF_CALL_Reset(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t t0, depth;
+  call_frame_t root;
+
+  // cost of one enter/exit pair as seen by the caller, last of 4
+  // (warm cache and prefetch), exit without table update. Measured
+  // as stack root, open frames (caller of PROFILING_START) untouched
+  __disable_irq();
+  depth = call_depth;
+  root = call_stack[0];
+  for (int i = 0; i < 4; i++)
+  {
+    call_depth = 0;
+    call_tail = call_head;
+    t0 = DWT->CYCCNT;
+    __cyg_profile_func_enter((void *)PROF_CALL_Reset, NULL);
+    __cyg_profile_func_exit((void *)PROF_CALL_Reset, NULL);
+    call_hook = DWT->CYCCNT - t0;
+  }
+  call_stack[0] = root;
+  call_depth = depth;
+  if (!primask)
+    __enable_irq();
+
+  call_clear();
+}
+
+
+/**
+ * @brief Add pending exit records to tables. Called by PROF_CALL_Report(),
+ *        PROF_CALL_Func() and PROF_CALL_Edge()
+ */
+void PROF_CALL_Flush(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  call_drain(PROFILING_CALL_RING);
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Statistic of one function
+ *
+ * @param fn   Function address
+ * @param stat Calls, exclusive and inclusive cycles
+ * @return 1 if function was called
+ */
+uint8_t PROF_CALL_Func(uint32_t fn, PROF_CALL_Stat_t *stat)
+{
+  PROF_CALL_Flush();
+  for (int i = 0; i < PROFILING_CALL_FUNCS; i++)
+  {
+    if (call_func[i].fn == fn && fn != 0)
+    {
+      stat->calls = call_func[i].calls;
+      stat->excl = call_func[i].excl;
+      stat->incl = call_func[i].incl;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+
+/**
+ * @brief Call count of caller->callee edge, caller 0 - stack root
+ */
+uint32_t PROF_CALL_Edge(uint32_t caller, uint32_t callee)
+{
+  PROF_CALL_Flush();
+  for (int i = 0; i < PROFILING_CALL_EDGES; i++)
+  {
+    if (call_edge[i].callee == callee && call_edge[i].caller == caller && callee != 0)
+      return call_edge[i].calls;
+  }
+  return 0;
+}
+
+
+/**
+ * @brief Print top PROFILING_CALL_TOP functions and edges
+ */
+void PROF_CALL_Report(void)
+{
+  uint16_t order[PROFILING_CALL_TOP];
+  int funcs = 0, edges = 0;
+  int count, i, j;
+
+  PROF_CALL_Flush();
+
+  // functions by exclusive time
+  count = 0;
+  for (i = 0; i < PROFILING_CALL_FUNCS; i++)
+  {
+    if (call_func[i].fn == 0)
+      continue;
+    funcs++;
+    for (j = count; j > 0 && call_func[order[j - 1]].excl < call_func[i].excl; j--)
+    {
+      if (j < PROFILING_CALL_TOP)
+        order[j] = order[j - 1];
+    }
+    if (j < PROFILING_CALL_TOP)
+    {
+      order[j] = i;
+      if (count < PROFILING_CALL_TOP)
+        count++;
+    }
+  }
+  for (i = 0; i < PROFILING_CALL_EDGES; i++)
+    edges += (call_edge[i].callee != 0);
+
+  DEBUG_PRINTF("Call graph: %d functions, %d edges, depth %u, hook %u cycles, table %u cycles/call\r\n"
+               "--Function----|---calls--|--exclusive--|--inclusive--\r\n",
+               funcs, edges, (unsigned)call_max_depth, (unsigned)call_hook,
+               (unsigned)(call_table_n ? call_table_cyc / call_table_n : 0));
+  for (i = 0; i < count; i++)
+  {
+    call_func_t *f = &call_func[order[i]];
+    DEBUG_PRINTF("0x%08X    : %8u | %11llu | %11llu\r\n", (unsigned)f->fn, (unsigned)f->calls,
+                 (unsigned long long)f->excl, (unsigned long long)f->incl);
+  }
+
+  // edges by calls
+  count = 0;
+  for (i = 0; i < PROFILING_CALL_EDGES; i++)
+  {
+    if (call_edge[i].callee == 0)
+      continue;
+    for (j = count; j > 0 && call_edge[order[j - 1]].calls < call_edge[i].calls; j--)
+    {
+      if (j < PROFILING_CALL_TOP)
+        order[j] = order[j - 1];
+    }
+    if (j < PROFILING_CALL_TOP)
+    {
+      order[j] = i;
+      if (count < PROFILING_CALL_TOP)
+        count++;
+    }
+  }
+
+  DEBUG_PRINTF("--Caller------|--Callee------|---calls--\r\n");
+  for (i = 0; i < count; i++)
+  {
+    call_edge_t *e = &call_edge[order[i]];
+    DEBUG_PRINTF("0x%08X    : 0x%08X   | %8u\r\n", (unsigned)e->caller, (unsigned)e->callee, (unsigned)e->calls);
+  }
+  if (call_lost)
+    DEBUG_PRINTF("%u calls lost, increase PROFILING_CALL_DEPTH/FUNCS\r\n", (unsigned)call_lost);
+  DEBUG_PRINTF("\r\n");
+}
+
+#endif // PROFILING_CALL_GRAPH
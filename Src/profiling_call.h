@@ -0,0 +1,39 @@
+#ifndef _PROFILING_CALL_H
+#define _PROFILING_CALL_H
+
+#include "profiling.h"
+
+/**
+ * Call graph profiler.
+ * Application sources compiled with -finstrument-functions (armcc
+ * --gnu_instrument) call __cyg_profile_func_enter/exit on every function
+ * entry and exit. Shadow stack of PROFILING_CALL_DEPTH frames gives
+ * inclusive and exclusive cycles per function and caller->callee call
+ * counts, kept in fixed size open addressing tables. Exit hook only
+ * writes a record, tables are updated in batches.
+ * Profiler sources must be compiled without instrumentation.
+ */
+#if PROFILING_CALL_GRAPH
+
+typedef struct
+{
+  uint32_t calls;
+  uint64_t excl;      // cycles
+  uint64_t incl;
+} PROF_CALL_Stat_t;
+
+void     PROF_CALL_Reset(void);
+void     PROF_CALL_Flush(void);
+void     PROF_CALL_Report(void);
+uint8_t  PROF_CALL_Func(uint32_t fn, PROF_CALL_Stat_t *stat);
+uint32_t PROF_CALL_Edge(uint32_t caller, uint32_t callee);
+
+#else
+
+#define PROF_CALL_Reset()       ((void)0)
+#define PROF_CALL_Flush()       ((void)0)
+#define PROF_CALL_Report()      ((void)0)
+
+#endif // PROFILING_CALL_GRAPH
+
+#endif // _PROFILING_CALL_H
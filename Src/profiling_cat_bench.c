@@ -0,0 +1,122 @@
+/***********************************************************************
+ File Name    : 'profiling_cat_bench.c'
+ Title        : PROFILER
+ Description  : Cost of disabled profiling points.
+                Same loop is measured plain, with event of category
+                removed at compile time, with event of category disabled
+                at runtime and with enabled event.
+                Compile-time removed variant must show the same cycles
+                as plain loop, and bench_plain/bench_compiled_out must
+                have the same size in Image Symbol Table of PROFILER.map.
+
+                Examle output:
+                Category bench, 1000 iterations:
+                --Variant---------------------|-cycles/iter-
+                plain loop                    :      4.00
+                compiled out (PROF_CAT_APP)   :      4.00
+                runtime off (PROF_CAT_DRIVER) :      7.00
+                enabled, no session           :     16.02
+
+ Target MCU   : STM32
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_cat_bench.h"
+
+#if PROFILING_CAT_BENCH && PROFILING_ENABLE
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+#define BENCH_LOOPS  1000
+
+// PROF_CAT_APP is compiled out in this file only
+#undef  PROFILING_CAT_MASK
+#define PROFILING_CAT_MASK  (PROF_CAT_ALL & ~PROF_CAT_APP)
+
+#define BENCH_NOINLINE  __attribute__((noinline))
+
+/* Private variables -------------------------------------------------*/
+static volatile uint32_t sink;
+
+/* Private function prototypes ---------------------------------------*/
+static uint32_t bench_plain(void);
+static uint32_t bench_compiled_out(void);
+static uint32_t bench_runtime(void);
+static void     bench_print(const char *name, uint32_t cycles);
+/* -------------------------------------------------------------------*/
+
+
+BENCH_NOINLINE static uint32_t bench_plain(void)
+{
+  uint32_t t0 = DWT->CYCCNT;
+
+  for (uint32_t i = 0; i < BENCH_LOOPS; i++)
+    sink = i;
+  return DWT->CYCCNT - t0;
+}
+
+
+BENCH_NOINLINE static uint32_t bench_compiled_out(void)
+{
+  uint32_t t0 = DWT->CYCCNT;
+
+  for (uint32_t i = 0; i < BENCH_LOOPS; i++)
+  {
+    sink = i;
+    PROFILING_EVENT_CAT(PROF_CAT_APP, "bench");
+  }
+  return DWT->CYCCNT - t0;
+}
+
+
+BENCH_NOINLINE static uint32_t bench_runtime(void)
+{
+  uint32_t t0 = DWT->CYCCNT;
+
+  for (uint32_t i = 0; i < BENCH_LOOPS; i++)
+  {
+    sink = i;
+    PROFILING_EVENT_CAT(PROF_CAT_DRIVER, "bench");
+  }
+  return DWT->CYCCNT - t0;
+}
+
+
+static void bench_print(const char *name, uint32_t cycles)
+{
+  DEBUG_PRINTF("%-30s:%7u.%02u\r\n", name, (unsigned)(cycles / BENCH_LOOPS), (unsigned)(cycles % BENCH_LOOPS / 10));
+}
+
+
+/**
+ * @brief Measure and print cycles per iteration of each variant
+ */
+void PROF_CAT_Bench(void)
+{
+  uint32_t mask = PROF_cat_mask;
+  uint32_t plain, out, off, on;
+
+  PROF_CYCCNT_ENABLE();
+  plain = bench_plain();
+  out = bench_compiled_out();
+
+  PROFILING_SET_MASK(mask & ~PROF_CAT_DRIVER);
+  off = bench_runtime();
+
+  // no session started: call and running check only
+  PROFILING_SET_MASK(mask | PROF_CAT_DRIVER);
+  on = bench_runtime();
+  PROFILING_SET_MASK(mask);
+
+  DEBUG_PRINTF("Category bench, %u iterations:\r\n"
+               "--Variant---------------------|-cycles/iter-\r\n", BENCH_LOOPS);
+  bench_print("plain loop", plain);
+  bench_print("compiled out (PROF_CAT_APP)", out);
+  bench_print("runtime off (PROF_CAT_DRIVER)", off);
+  bench_print("enabled, no session", on);
+  DEBUG_PRINTF("\r\n");
+}
+
+#endif // PROFILING_CAT_BENCH
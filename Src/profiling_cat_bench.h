@@ -0,0 +1,12 @@
+#ifndef _PROFILING_CAT_BENCH_H
+#define _PROFILING_CAT_BENCH_H
+
+#include "profiling.h"
+
+#if PROFILING_CAT_BENCH && PROFILING_ENABLE
+void PROF_CAT_Bench(void);
+#else
+#define PROF_CAT_Bench()        ((void)0)
+#endif
+
+#endif // _PROFILING_CAT_BENCH_H
@@ -0,0 +1,165 @@
+/***********************************************************************
+ File Name    : 'profiling_ccm_bench.c'
+ Title        : PROFILER
+ Description  : Flash vs CCM RAM execution.
+                Every workload body is compiled twice, as flash function
+                and as PROF_CCM_CODE function in CCM RAM. Data is in SRAM
+                for both, so CCM code fetch (I-bus) does not compete
+                with data access (D-bus/S-bus).
+                Fastest of CCM_RUNS runs with interrupts masked is kept.
+                Flash result depends on wait states and prefetch
+                (profiling_ws_sweep.c), CCM RAM has none.
+
+                Examle output:
+                CCM bench, 72000000 Hz, 2 WS, prefetch on:
+                --Workload--------------------|----flash-|------CCM-|-speedup-
+                mac loop                      |   266.00 |   200.00 |   1.33x
+                branchy                       |   702.00 |   449.00 |   1.56x
+                crc bitwise                   |  1540.00 |  1282.00 |   1.20x
+
+ Target MCU   : STM32F30x
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_ccm_bench.h"
+
+#if PROFILING_CCM_BENCH && PROFILING_ENABLE
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+#define BENCH_NOINLINE  __attribute__((noinline))
+#define CCM_N       64
+#define CCM_LOOPS   100
+#define CCM_RUNS    5
+
+// workload bodies, same source for flash and CCM variant
+#define MAC_BODY                                  \
+  int32_t s = 0;                                  \
+  for (int i = 0; i < CCM_N; i++)                 \
+    s += (int32_t)ccm_a[i] * (int32_t)ccm_b[i];   \
+  sink = s;
+
+#define BRANCHY_BODY                              \
+  uint32_t s = 0;                                 \
+  for (int i = 0; i < CCM_N; i++)                 \
+  {                                               \
+    switch (ccm_a[i] & 3)                         \
+    {                                             \
+      case 0:  s += ccm_b[i]; break;              \
+      case 1:  s ^= i; break;                     \
+      case 2:  s <<= 1; break;                    \
+      default: s--; break;                        \
+    }                                             \
+  }                                               \
+  sink = s;
+
+#define CRC_BODY                                  \
+  uint32_t crc = 0xFFFFFFFF;                      \
+  for (int i = 0; i < CCM_N / 4; i++)             \
+  {                                               \
+    crc ^= ccm_a[i];                              \
+    for (int b = 0; b < 8; b++)                   \
+      crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1)); \
+  }                                               \
+  sink = crc;
+
+typedef void (*ccm_fn_t)(void);
+
+typedef struct
+{
+  const char *name;
+  ccm_fn_t   flash;
+  ccm_fn_t   ccm;
+} ccm_load_t;
+
+/* Private function prototypes ---------------------------------------*/
+static void mac_flash(void);
+static void mac_ccm(void);
+static void branchy_flash(void);
+static void branchy_ccm(void);
+static void crc_flash(void);
+static void crc_ccm(void);
+static uint32_t bench_run(ccm_fn_t fn);
+
+/* Private variables -------------------------------------------------*/
+static uint32_t ccm_a[CCM_N];
+static uint32_t ccm_b[CCM_N];
+static volatile uint32_t sink;
+
+static const ccm_load_t load[] =
+{
+  { "mac loop",    mac_flash,     mac_ccm },
+  { "branchy",     branchy_flash, branchy_ccm },
+  { "crc bitwise", crc_flash,     crc_ccm },
+};
+/* -------------------------------------------------------------------*/
+
+
+BENCH_NOINLINE static void mac_flash(void) { MAC_BODY }
+PROF_CCM_CODE static void mac_ccm(void) { MAC_BODY }
+BENCH_NOINLINE static void branchy_flash(void) { BRANCHY_BODY }
+PROF_CCM_CODE static void branchy_ccm(void) { BRANCHY_BODY }
+BENCH_NOINLINE static void crc_flash(void) { CRC_BODY }
+PROF_CCM_CODE static void crc_ccm(void) { CRC_BODY }
+
+
+/**
+ * @brief Fastest of CCM_RUNS runs
+ *
+ * @return Cycles of CCM_LOOPS calls
+ */
+static uint32_t bench_run(ccm_fn_t fn)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t best = 0xFFFFFFFF;
+  uint32_t t0;
+
+  __disable_irq();
+  for (int r = 0; r < CCM_RUNS; r++)
+  {
+    t0 = DWT->CYCCNT;
+    for (int i = 0; i < CCM_LOOPS; i++)
+      fn();
+    t0 = DWT->CYCCNT - t0;
+    if (t0 < best)
+      best = t0;
+  }
+  if (!primask)
+    __enable_irq();
+  return best;
+}
+
+
+/**
+ * @brief Measure and print cycles per call from flash and CCM RAM
+ */
+void PROF_CCM_Bench(void)
+{
+  uint32_t seed = 1;
+  uint32_t flash, ccm;
+
+  for (int i = 0; i < CCM_N; i++)
+  {
+    seed = seed * 1664525 + 1013904223;
+    ccm_a[i] = seed >> 16;
+    ccm_b[i] = seed & 0xFFFF;
+  }
+
+  PROF_CYCCNT_ENABLE();
+  DEBUG_PRINTF("CCM bench, %u Hz, %u WS, prefetch %s:\r\n"
+               "--Workload--------------------|----flash-|------CCM-|-speedup-\r\n",
+               (unsigned)SystemCoreClock, (unsigned)(FLASH->ACR & FLASH_ACR_LATENCY),
+               (FLASH->ACR & FLASH_ACR_PRFTBS) ? "on" : "off");
+  for (int i = 0; i < (int)(sizeof(load) / sizeof(load[0])); i++)
+  {
+    flash = bench_run(load[i].flash);
+    ccm = bench_run(load[i].ccm);
+    DEBUG_PRINTF("%-30s|%9.2f |%9.2f |%7.2fx\r\n", load[i].name,
+                 (float)flash / CCM_LOOPS, (float)ccm / CCM_LOOPS, (float)flash / ccm);
+  }
+  DEBUG_PRINTF("\r\n");
+}
+
+#endif // PROFILING_CCM_BENCH
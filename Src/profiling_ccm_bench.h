@@ -0,0 +1,20 @@
+#ifndef _PROFILING_CCM_BENCH_H
+#define _PROFILING_CCM_BENCH_H
+
+#include "profiling.h"
+
+/**
+ * Same code executed from flash and from CCM RAM (PROF_CCM_CODE),
+ * cycles per iteration and speedup printed.
+ */
+#if PROFILING_CCM_BENCH && PROFILING_ENABLE
+
+void PROF_CCM_Bench(void);
+
+#else
+
+#define PROF_CCM_Bench() ((void)0)
+
+#endif // PROFILING_CCM_BENCH
+
+#endif // _PROFILING_CCM_BENCH_H
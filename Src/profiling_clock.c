@@ -0,0 +1,128 @@
+/***********************************************************************
+ File Name    : 'profiling_clock.c'
+ Title        : PROFILER
+ Description  : Clock change aware time conversion.
+                Last PROFILING_CLOCK_EPOCHS clock changes are kept in
+                ring as (CYCCNT, old Hz, new Hz). Interval t0..t1 is
+                split at every change inside it and each part is
+                divided by its own frequency.
+                PROF_CLOCK_Convert() uses only its arguments and can be
+                built and checked on host.
+
+ Target MCU   : STM32
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_clock.h"
+
+#if PROFILING_CLOCK_EPOCHS
+
+/* Private variables -------------------------------------------------*/
+static PROF_CLOCK_Epoch_t epoch[PROFILING_CLOCK_EPOCHS];
+static uint8_t epoch_pos;     // next write position
+static uint8_t epoch_count;
+
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Record clock change
+ *
+ * @param hz_old Core clock before switch
+ * @param hz_new Core clock after switch, same as hz_old - no change
+ */
+void PROF_CLOCK_Notify(uint32_t hz_old, uint32_t hz_new)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  if (hz_new == hz_old)
+    return;
+
+  __disable_irq();
+  epoch[epoch_pos].cyccnt = DWT->CYCCNT;
+  epoch[epoch_pos].hz_old = hz_old;
+  epoch[epoch_pos].hz_new = hz_new;
+  if (++epoch_pos >= PROFILING_CLOCK_EPOCHS)
+    epoch_pos = 0;
+  if (epoch_count < PROFILING_CLOCK_EPOCHS)
+    epoch_count++;
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Convert interval t0..t1 using recorded clock changes
+ *
+ * @return Interval length, us
+ */
+uint32_t PROF_CLOCK_ToUs(uint32_t t0, uint32_t t1)
+{
+  PROF_CLOCK_Epoch_t e[PROFILING_CLOCK_EPOCHS];
+  uint32_t primask = __get_PRIMASK();
+  uint8_t count, pos;
+
+  __disable_irq();
+  count = epoch_count;
+  pos = (epoch_pos + PROFILING_CLOCK_EPOCHS - epoch_count) % PROFILING_CLOCK_EPOCHS;
+  for (int i = 0; i < count; i++)
+  {
+    e[i] = epoch[pos];
+    if (++pos >= PROFILING_CLOCK_EPOCHS)
+      pos = 0;
+  }
+  if (!primask)
+    __enable_irq();
+
+  return PROF_CLOCK_Convert(e, count, SystemCoreClock, t0, t1);
+}
+
+
+/**
+ * @brief Piecewise cycles to us conversion
+ *
+ * @param epoch Clock changes, oldest first, within 2^31 cycles of t0
+ * @param count Number of changes
+ * @param hz    Frequency used when there is no change before t0
+ * @param t0    Interval start, cycles
+ * @param t1    Interval end, cycles
+ *
+ * @return Interval length, us
+ */
+uint32_t PROF_CLOCK_Convert(const PROF_CLOCK_Epoch_t *epoch, uint8_t count, uint32_t hz,
+                            uint32_t t0, uint32_t t1)
+{
+  uint32_t span = t1 - t0;
+  uint32_t from = 0;          // part start, cycles from t0
+  uint64_t us = 0;
+  int32_t offset;
+  int i;
+
+  // frequency at t0: last change before it, or old frequency of first change after it
+  for (i = 0; i < count; i++)
+  {
+    offset = (int32_t)(epoch[i].cyccnt - t0);
+    if (offset > 0)
+      break;
+    hz = epoch[i].hz_new;
+  }
+  if (i < count && i == 0)
+    hz = epoch[0].hz_old;
+
+  for (; i < count; i++)
+  {
+    offset = (int32_t)(epoch[i].cyccnt - t0);
+    if ((uint32_t)offset >= span)
+      break;
+    us += (uint64_t)((uint32_t)offset - from) * 1000000 / hz;
+    from = (uint32_t)offset;
+    hz = epoch[i].hz_new;
+  }
+  us += (uint64_t)(span - from) * 1000000 / hz;
+
+  return (uint32_t)us;
+}
+
+#endif // PROFILING_CLOCK_EPOCHS
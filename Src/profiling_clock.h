@@ -0,0 +1,33 @@
+#ifndef _PROFILING_CLOCK_H
+#define _PROFILING_CLOCK_H
+
+#include "profiling.h"
+
+/**
+ * Clock change aware time conversion.
+ * Call PROF_CLOCK_Notify() with frequency before and after right after
+ * core clock is switched (SystemCoreClockUpdate() does it, it passes
+ * SystemCoreClock from before its update). Intervals are converted to us
+ * piecewise, each part with frequency valid at that time.
+ */
+#if PROFILING_CLOCK_EPOCHS
+
+typedef struct
+{
+  uint32_t cyccnt;        // DWT_CYCCNT at change
+  uint32_t hz_old;
+  uint32_t hz_new;
+} PROF_CLOCK_Epoch_t;
+
+void     PROF_CLOCK_Notify(uint32_t hz_old, uint32_t hz_new);
+uint32_t PROF_CLOCK_ToUs(uint32_t t0, uint32_t t1);
+uint32_t PROF_CLOCK_Convert(const PROF_CLOCK_Epoch_t *epoch, uint8_t count, uint32_t hz,
+                            uint32_t t0, uint32_t t1);
+
+#else
+
+#define PROF_CLOCK_Notify(hz_old, hz_new)   ((void)0)
+
+#endif // PROFILING_CLOCK_EPOCHS
+
+#endif // _PROFILING_CLOCK_H
@@ -0,0 +1,184 @@
+/***********************************************************************
+ File Name    : 'profiling_conf.h'
+ Title        : PROFILER
+ Description  : Profiler configuration file.
+                Set option to 1 to enable, 0 to compile it out.
+ Target MCU   : STM32
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+#ifndef _PROFILING_CONF_H
+#define _PROFILING_CONF_H
+
+/* Profiler master switch ---------------------------------------------*/
+#ifndef PROFILING_ENABLE
+#define PROFILING_ENABLE        1   // 0 - PROFILING_xxx compile to nothing
+#endif
+
+/* CCM RAM placement -------------------------------------------------*/
+#ifndef PROFILING_CCM
+#define PROFILING_CCM           0   // 1 - PROFILING_EVENT() and sessions in CCM RAM
+#endif
+
+/* Event categories for PROFILING_xxx_CAT() ----------------------------*/
+#define PROF_CAT_APP            0x00000001
+#define PROF_CAT_DRIVER         0x00000002
+#define PROF_CAT_ISR            0x00000004
+#define PROF_CAT_COMM           0x00000008
+#define PROF_CAT_ALL            0xFFFFFFFF
+
+#ifndef PROFILING_CAT_MASK
+#define PROFILING_CAT_MASK      PROF_CAT_ALL // compiled in categories
+#endif
+
+#ifndef PROFILING_CAT_BENCH
+#define PROFILING_CAT_BENCH     0   // PROF_CAT_Bench(), cost of disabled events
+#endif
+
+/* Critical section (PRIMASK/BASEPRI) duration tracker ---------------*/
+#ifndef PROFILING_CS_TRACE
+#define PROFILING_CS_TRACE      0
+#endif
+#define PROFILING_CS_TOP_COUNT  8   // number of longest sections kept
+
+/* Stack high-water mark per profiling session ----------------------*/
+#ifndef PROFILING_STACK_WATERMARK
+#define PROFILING_STACK_WATERMARK 0
+#endif
+#define PROFILING_STACK_PATTERN   0xA5A5A5A5 // unused stack fill pattern
+#define PROFILING_STACK_MARGIN    64         // bytes below SP left unpainted
+
+/* CPU load meter (SysTick windows, WFI idle hook) ------------------*/
+#ifndef PROFILING_LOAD_METER
+#define PROFILING_LOAD_METER    0
+#endif
+#define PROFILING_LOAD_HISTORY  10  // 100 ms windows kept in ring
+
+/* Per-context sessions and context switch tracing ------------------*/
+#ifndef PROFILING_CONTEXT_COUNT
+#define PROFILING_CONTEXT_COUNT 1   // 1 - single global session, no switch hooks
+#endif
+#define PROFILING_SWITCH_TRACE  32  // last context switches kept in ring
+
+/* Session handles (concurrent named sessions) ----------------------*/
+#ifndef PROFILING_SESSION_POOL
+#define PROFILING_SESSION_POOL  4   // PROFILING_SESSION_START() sessions, 0 - API off
+#endif
+
+/* Fault snapshot (HardFault/MemManage/BusFault/UsageFault) ---------*/
+#ifndef PROFILING_FAULT_DUMP
+#define PROFILING_FAULT_DUMP    0
+#endif
+#define PROFILING_FAULT_EVENTS  8   // last session events saved in snapshot
+#define PROFILING_FAULT_RESET   1   // 1 - reset after dump, 0 - stay in loop
+
+/* Capture log in internal flash -------------------------------------*/
+#ifndef PROFILING_FLASH_LOG
+#define PROFILING_FLASH_LOG       0
+#endif
+#define PROFILING_FLASH_LOG_ADDR  0x0803E000 // reserved in PROFILER.sct
+#define PROFILING_FLASH_LOG_PAGES 4          // 2 KB pages, used as ring
+#define PROFILING_FLASH_NAME_LEN  16         // stored name length, truncated
+
+/* Boot time profiling from Reset_Handler ----------------------------*/
+#ifndef PROFILING_BOOT
+#define PROFILING_BOOT          0
+#endif
+#define PROFILING_BOOT_MARKS    8   // boot phases merged into first session
+
+/* RTC anchored wall clock timestamps --------------------------------*/
+#ifndef PROFILING_RTC_CLOCK
+#define PROFILING_RTC_CLOCK       0
+#endif
+#define PROFILING_RTC_RESYNC_MS   10000 // < 59 s, CYCCNT wrap at 72 MHz
+
+/* Clock change aware time conversion --------------------------------*/
+#ifndef PROFILING_CLOCK_EPOCHS
+#define PROFILING_CLOCK_EPOCHS  0   // number of clock changes kept, 0 - off
+#endif
+
+/* Cross-reset statistics in RTC backup registers --------------------*/
+#ifndef PROFILING_BKP_STATS
+#define PROFILING_BKP_STATS     0
+#endif
+#define PROFILING_BKP_SLOTS     4   // tracked events, 3 backup registers each
+
+/* Sampled events for high frequency code ---------------------------*/
+#ifndef PROFILING_SAMPLE
+#define PROFILING_SAMPLE          0
+#endif
+#define PROFILING_SAMPLE_RATE     50  // adaptive sites, records per second
+#define PROFILING_SAMPLE_WINDOW_MS 100 // adaptive period recalculation
+
+/* StdPeriph driver call statistics (link time wrappers) ------------*/
+#ifndef PROFILING_DRV_WRAP
+#define PROFILING_DRV_WRAP      0
+#endif
+#define PROFILING_DRV_SLOTS     64  // hash table size, power of 2
+
+/* Call graph profiler (-finstrument-functions hooks) ---------------*/
+#ifndef PROFILING_CALL_GRAPH
+#define PROFILING_CALL_GRAPH    0
+#endif
+#define PROFILING_CALL_DEPTH    32  // shadow stack frames
+#define PROFILING_CALL_FUNCS    128 // function table size, power of 2
+#define PROFILING_CALL_EDGES    256 // caller->callee table size, power of 2
+#ifndef PROFILING_CALL_RING
+#define PROFILING_CALL_RING     64  // exit records, power of 2, tables updated per quarter
+#endif
+#define PROFILING_CALL_TOP      16  // printed functions and edges
+
+/* Microbenchmark harness --------------------------------------------*/
+#ifndef PROFILING_BENCH
+#define PROFILING_BENCH         0
+#endif
+#define PROFILING_BENCH_MAX     16  // registered benchmarks
+#define PROFILING_BENCH_SAMPLES 15  // timed batches per benchmark
+#define PROFILING_BENCH_MIN_MS  10  // minimum batch duration
+
+/* CMSIS-DSP kernel benchmark suite ----------------------------------*/
+#ifndef PROFILING_DSP_BENCH
+#define PROFILING_DSP_BENCH     0   // needs PROFILING_BENCH, arm_cortexM4lf_math linked
+#endif
+
+/* Flash wait state / prefetch / half cycle sweep --------------------*/
+#ifndef PROFILING_WS_SWEEP
+#define PROFILING_WS_SWEEP      0   // needs PROFILING_BENCH
+#endif
+
+/* Flash vs CCM RAM execution benchmark ------------------------------*/
+#ifndef PROFILING_CCM_BENCH
+#define PROFILING_CCM_BENCH     0
+#endif
+
+/* DMA memcpy/memset with CPU fallback -------------------------------*/
+#ifndef PROFILING_DMA
+#define PROFILING_DMA           0
+#endif
+#define PROFILING_DMA_CH        1   // DMA1 channel, memory to memory
+#define PROFILING_DMA_CROSSOVER 128 // bytes, until PROF_DMA_Calibrate()
+
+/* Hardware CRC streaming API ---------------------------------------*/
+#ifndef PROFILING_CRC
+#define PROFILING_CRC           0
+#endif
+#define PROFILING_CRC_DMA_MIN   256 // bytes, PROF_CRC_UpdateDMA() below by CPU
+
+/* DWT delay / timeout, tickless SysTick ----------------------------*/
+#ifndef PROFILING_DELAY
+#define PROFILING_DELAY         0
+#endif
+#ifndef PROFILING_TICKLESS
+#define PROFILING_TICKLESS      0   // needs PROFILING_DELAY, SysTick 2^24 cycles instead of 1 ms
+#endif
+#define PROFILING_DELAY_SPIN_US 10  // PROF_DELAY_Sleep_ms() busy waits last part
+
+/* Trigger capture (pre/post trigger event ring) -------------------*/
+#ifndef PROFILING_TRIGGER
+#define PROFILING_TRIGGER       0
+#endif
+#define PROFILING_TRIG_RING     32  // recorded events, power of 2
+#define PROFILING_TRIG_RULES    4
+
+#endif // _PROFILING_CONF_H
@@ -0,0 +1,447 @@
+/***********************************************************************
+ File Name    : 'profiling_crc.c'
+ Title        : PROFILER
+ Description  : Hardware CRC streaming API with DMA feed.
+                PROF_CRC_Begin() sets polynomial, size and init value,
+                PROF_CRC_Update() may be called with any length and
+                alignment: head bytes up to word alignment, then words,
+                then half word and byte tail, each with its own DR write
+                width. Reflected models use REV_IN of the write width,
+                so whole words are fed from little endian memory as is.
+                Not reflected models swap bytes with __REV() on CPU;
+                DMA cannot swap, so their DMA feed uses byte writes.
+                Output reflection and xorout are done in software.
+                PROF_CRC_UpdateDMA() feeds CRC->DR by PROF_DMA_Feed(),
+                tail is written in the DMA completion callback.
+                PROF_CRC_Soft() is byte table driven reference.
+
+                Examle output:
+                CRC bench, 72000000 Hz, 4096 bytes:
+                --Method----------------------|---cycles-|-cyc/byte-|-------CRC-
+                soft table CRC-32             |    36952 |     9.02 | 0x6A2B8C3F
+                hw CPU CRC-32                 |     5187 |     1.27 | 0x6A2B8C3F
+                hw DMA CRC-32                 |     4386 |     1.07 | 0x6A2B8C3F
+                soft table CRC-32/MPEG-2      |    36949 |     9.02 | 0x1E9D4A70
+                hw CPU CRC-32/MPEG-2          |     6211 |     1.52 | 0x1E9D4A70
+                hw DMA CRC-32/MPEG-2          |    16448 |     4.02 | 0x1E9D4A70
+                CRC_CalcBlockCRC words        |     5133 |     1.25 | 0x8F1D03B2
+                Check "123456789":
+                CRC-32              : 0xCBF43926 ok
+                CRC-32/MPEG-2       : 0x0376E6E7 ok
+                CRC-16/CCITT        : 0x000029B1 ok
+                CRC-16/MODBUS       : 0x00004B37 ok
+                CRC-8               : 0x000000F4 ok
+                CRC-7/MMC           : 0x00000075 ok
+
+ Target MCU   : STM32F30x
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_crc.h"
+
+#if PROFILING_CRC
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+#define CRC_MASK(n)     ((n) >= 32 ? 0xFFFFFFFF : (1u << (n)) - 1)
+#define CRC_REV_IN(r)   (CRC->CR = (CRC->CR & ~CRC_CR_REV_IN) | (r))
+#define CRC_DR8         (*(volatile uint8_t *)&CRC->DR)
+#define CRC_DR16        (*(volatile uint16_t *)&CRC->DR)
+#define CRC_RUNS        3
+
+typedef struct
+{
+  const PROF_CRC_Config_t *cfg;
+#if PROFILING_DMA
+  const uint8_t     *tail;  // written after DMA completion
+  uint32_t          tail_size;
+  PROF_DMA_Callback done;
+  void              *arg;
+#endif
+} crc_state_t;
+
+/* Private variables -------------------------------------------------*/
+static crc_state_t crc;
+static uint32_t soft_table[256];
+static const PROF_CRC_Config_t *soft_cfg;
+
+const PROF_CRC_Config_t PROF_CRC_32        = { "CRC-32",        0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, 0xCBF43926, 32, 1 };
+const PROF_CRC_Config_t PROF_CRC_32_MPEG2  = { "CRC-32/MPEG-2", 0x04C11DB7, 0xFFFFFFFF, 0x00000000, 0x0376E6E7, 32, 0 };
+const PROF_CRC_Config_t PROF_CRC_16_CCITT  = { "CRC-16/CCITT",  0x1021,     0xFFFF,     0x0000,     0x29B1,     16, 0 };
+const PROF_CRC_Config_t PROF_CRC_16_MODBUS = { "CRC-16/MODBUS", 0x8005,     0xFFFF,     0x0000,     0x4B37,     16, 1 };
+const PROF_CRC_Config_t PROF_CRC_8         = { "CRC-8",         0x07,       0x00,       0x00,       0xF4,       8,  0 };
+const PROF_CRC_Config_t PROF_CRC_7_MMC     = { "CRC-7/MMC",     0x09,       0x00,       0x00,       0x75,       7,  0 };
+
+static const PROF_CRC_Config_t * const crc_models[] =
+{
+  &PROF_CRC_32, &PROF_CRC_32_MPEG2, &PROF_CRC_16_CCITT,
+  &PROF_CRC_16_MODBUS, &PROF_CRC_8, &PROF_CRC_7_MMC,
+};
+
+/* Private function prototypes ---------------------------------------*/
+static void crc_feed(const uint8_t *p, uint32_t size);
+static void soft_build(const PROF_CRC_Config_t *cfg);
+#if PROFILING_DMA
+static void crc_dma_done(void *arg, uint8_t error);
+#endif
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Configure CRC unit and reset DR to init value
+ */
+void PROF_CRC_Begin(const PROF_CRC_Config_t *cfg)
+{
+  RCC_AHBPeriphClockCmd(RCC_AHBPeriph_CRC, ENABLE);
+  crc.cfg = cfg;
+  CRC_SetPolynomial(cfg->poly);
+  CRC_PolynomialSizeSelect(cfg->size == 7 ? CRC_PolSize_7 :
+                           cfg->size == 8 ? CRC_PolSize_8 :
+                           cfg->size == 16 ? CRC_PolSize_16 : CRC_PolSize_32);
+  CRC_ReverseInputDataSelect(CRC_ReverseInputData_No);
+  CRC_ReverseOutputDataCmd(DISABLE);
+  CRC_SetInitRegister(cfg->init);
+  CRC_ResetDR();
+}
+
+
+/**
+ * @brief Write bytes to DR, widest write the alignment allows
+ */
+static void crc_feed(const uint8_t *p, uint32_t size)
+{
+  uint8_t reflect = crc.cfg->reflect;
+  const uint32_t *w;
+  uint32_t n;
+
+  if (reflect)
+    CRC_REV_IN(CRC_ReverseInputData_8bits);
+  while (size && ((uint32_t)p & 3))
+  {
+    CRC_DR8 = *p++;
+    size--;
+  }
+
+  w = (const uint32_t *)p;
+  n = size / 4;
+  if (n)
+  {
+    if (reflect)
+    {
+      CRC_REV_IN(CRC_ReverseInputData_32bits);
+      for (; n >= 4; n -= 4, w += 4)
+      {
+        CRC->DR = w[0];
+        CRC->DR = w[1];
+        CRC->DR = w[2];
+        CRC->DR = w[3];
+      }
+      while (n--)
+        CRC->DR = *w++;
+    }
+    else
+    {
+      for (; n >= 4; n -= 4, w += 4)
+      {
+        CRC->DR = __REV(w[0]);
+        CRC->DR = __REV(w[1]);
+        CRC->DR = __REV(w[2]);
+        CRC->DR = __REV(w[3]);
+      }
+      while (n--)
+        CRC->DR = __REV(*w++);
+    }
+  }
+
+  p = (const uint8_t *)w;
+  if (size & 2)
+  {
+    if (reflect)
+    {
+      CRC_REV_IN(CRC_ReverseInputData_16bits);
+      CRC_DR16 = *(const uint16_t *)p;
+    }
+    else
+      CRC_DR16 = __REV16(*(const uint16_t *)p);
+    p += 2;
+  }
+  if (size & 1)
+  {
+    if (reflect)
+      CRC_REV_IN(CRC_ReverseInputData_8bits);
+    CRC_DR8 = *p;
+  }
+}
+
+
+/**
+ * @brief Add bytes to CRC, any length and alignment
+ */
+void PROF_CRC_Update(const void *data, uint32_t size)
+{
+  crc_feed(data, size);
+}
+
+
+/**
+ * @brief Output reflection and xorout
+ *
+ * @return CRC of all bytes since PROF_CRC_Begin()
+ */
+uint32_t PROF_CRC_End(void)
+{
+  const PROF_CRC_Config_t *cfg = crc.cfg;
+  uint32_t r = CRC->DR & CRC_MASK(cfg->size);
+
+  if (cfg->reflect)
+    r = __RBIT(r) >> (32 - cfg->size);
+  return (r ^ cfg->xorout) & CRC_MASK(cfg->size);
+}
+
+
+#if PROFILING_DMA
+/**
+ * @brief DMA part written, tail by CPU
+ */
+static void crc_dma_done(void *arg, uint8_t error)
+{
+  crc_feed(crc.tail, crc.tail_size);
+  if (crc.done)
+    crc.done(crc.arg, error);
+}
+
+
+/**
+ * @brief Add bytes to CRC by DMA, PROF_DMA_Init() first. CRC unit must
+ *        not be used until completion callback or PROF_DMA_Wait()
+ *
+ * @param data Source, SRAM or flash
+ * @param size Bytes, below PROFILING_CRC_DMA_MIN done by CPU
+ * @param done Completion callback or NULL
+ * @param arg  Callback argument
+ * @return PROF_DMA_CPU or PROF_DMA_STARTED
+ */
+uint8_t PROF_CRC_UpdateDMA(const void *data, uint32_t size, PROF_DMA_Callback done, void *arg)
+{
+  const uint8_t *p = data;
+  uint32_t head = (0 - (uint32_t)p) & 3;
+  uint8_t width = crc.cfg->reflect ? 4 : 1;
+  uint32_t body;
+
+  if (size < PROFILING_CRC_DMA_MIN || size < head + 4)
+  {
+    crc_feed(p, size);
+    if (done)
+      done(arg, 0);
+    return PROF_DMA_CPU;
+  }
+
+  crc_feed(p, head);
+  p += head;
+  size -= head;
+  body = (width == 4) ? size & ~3u : size;
+  crc.tail = p + body;
+  crc.tail_size = size - body;
+  crc.done = done;
+  crc.arg = arg;
+  if (width == 4)
+    CRC_REV_IN(CRC_ReverseInputData_32bits);
+  return PROF_DMA_Feed(&CRC->DR, p, body, width, crc_dma_done, NULL);
+}
+#endif // PROFILING_DMA
+
+
+/**
+ * @brief One shot CRC, by DMA if PROFILING_DMA and size is large
+ *        enough, e.g. firmware image check at boot
+ *
+ * @return CRC
+ */
+uint32_t PROF_CRC_Calc(const PROF_CRC_Config_t *cfg, const void *data, uint32_t size)
+{
+  PROF_CRC_Begin(cfg);
+#if PROFILING_DMA
+  if (PROF_DMA_Ready())
+  {
+    PROF_CRC_UpdateDMA(data, size, NULL, NULL);
+    PROF_DMA_Wait();
+  }
+  else
+  {
+    // e.g. image check before PROF_DMA_Init()
+    crc_feed(data, size);
+  }
+#else
+  crc_feed(data, size);
+#endif
+  return PROF_CRC_End();
+}
+
+
+/**
+ * @brief Table for byte wise software CRC
+ */
+static void soft_build(const PROF_CRC_Config_t *cfg)
+{
+  uint32_t poly, c;
+
+  if (cfg->reflect)
+  {
+    poly = __RBIT(cfg->poly) >> (32 - cfg->size);
+    for (uint32_t i = 0; i < 256; i++)
+    {
+      c = i;
+      for (int b = 0; b < 8; b++)
+        c = (c & 1) ? (c >> 1) ^ poly : c >> 1;
+      soft_table[i] = c;
+    }
+  }
+  else
+  {
+    // register left aligned, works for size < 8 too
+    poly = cfg->poly << (32 - cfg->size);
+    for (uint32_t i = 0; i < 256; i++)
+    {
+      c = i << 24;
+      for (int b = 0; b < 8; b++)
+        c = (c & 0x80000000) ? (c << 1) ^ poly : c << 1;
+      soft_table[i] = c;
+    }
+  }
+  soft_cfg = cfg;
+}
+
+
+/**
+ * @brief Table driven software CRC, table is rebuilt when cfg changes
+ *
+ * @return CRC
+ */
+uint32_t PROF_CRC_Soft(const PROF_CRC_Config_t *cfg, const void *data, uint32_t size)
+{
+  const uint8_t *p = data;
+  uint32_t c;
+
+  if (soft_cfg != cfg)
+    soft_build(cfg);
+
+  if (cfg->reflect)
+  {
+    c = __RBIT(cfg->init) >> (32 - cfg->size);
+    while (size--)
+      c = soft_table[(c ^ *p++) & 0xFF] ^ (c >> 8);
+  }
+  else
+  {
+    c = cfg->init << (32 - cfg->size);
+    while (size--)
+      c = soft_table[(c >> 24) ^ *p++] ^ (c << 8);
+    c >>= 32 - cfg->size;
+  }
+  return (c ^ cfg->xorout) & CRC_MASK(cfg->size);
+}
+
+
+/**
+ * @brief Print software, hardware CPU and DMA CRC of buffer and check
+ *        values of all models to ITM Stimulus Port 0
+ *
+ * @param buf  Scratch buffer in SRAM, 4 byte aligned, contents destroyed
+ * @param size Buffer size
+ */
+void PROF_CRC_Bench(void *buf, uint32_t size)
+{
+  static const PROF_CRC_Config_t * const bench_models[] = { &PROF_CRC_32, &PROF_CRC_32_MPEG2 };
+  static const uint8_t check[] = "123456789";
+  const PROF_CRC_Config_t *cfg;
+  uint32_t seed = 1;
+  uint32_t t, best, r;
+  char name[32];
+
+  for (uint32_t i = 0; i < size / 4; i++)
+  {
+    seed = seed * 1664525 + 1013904223;
+    ((uint32_t *)buf)[i] = seed;
+  }
+
+  PROF_CYCCNT_ENABLE();
+  DEBUG_PRINTF("CRC bench, %u Hz, %u bytes:\r\n"
+               "--Method----------------------|---cycles-|-cyc/byte-|-------CRC-\r\n",
+               (unsigned)SystemCoreClock, (unsigned)size);
+
+  for (int m = 0; m < (int)(sizeof(bench_models) / sizeof(bench_models[0])); m++)
+  {
+    cfg = bench_models[m];
+
+    PROF_CRC_Soft(cfg, buf, 0);  // table build not timed
+    best = 0xFFFFFFFF;
+    for (int i = 0; i < CRC_RUNS; i++)
+    {
+      t = DWT->CYCCNT;
+      r = PROF_CRC_Soft(cfg, buf, size);
+      t = DWT->CYCCNT - t;
+      if (t < best)
+        best = t;
+    }
+    snprintf(name, sizeof(name), "soft table %s", cfg->name);
+    DEBUG_PRINTF("%-30s|%9u |%9.2f | 0x%08X\r\n", name, (unsigned)best, (float)best / size, (unsigned)r);
+
+    best = 0xFFFFFFFF;
+    for (int i = 0; i < CRC_RUNS; i++)
+    {
+      t = DWT->CYCCNT;
+      PROF_CRC_Begin(cfg);
+      crc_feed(buf, size);
+      r = PROF_CRC_End();
+      t = DWT->CYCCNT - t;
+      if (t < best)
+        best = t;
+    }
+    snprintf(name, sizeof(name), "hw CPU %s", cfg->name);
+    DEBUG_PRINTF("%-30s|%9u |%9.2f | 0x%08X\r\n", name, (unsigned)best, (float)best / size, (unsigned)r);
+
+#if PROFILING_DMA
+    best = 0xFFFFFFFF;
+    for (int i = 0; i < CRC_RUNS; i++)
+    {
+      t = DWT->CYCCNT;
+      r = PROF_CRC_Calc(cfg, buf, size);
+      t = DWT->CYCCNT - t;
+      if (t < best)
+        best = t;
+    }
+    snprintf(name, sizeof(name), "hw DMA %s", cfg->name);
+    DEBUG_PRINTF("%-30s|%9u |%9.2f | 0x%08X\r\n", name, (unsigned)best, (float)best / size, (unsigned)r);
+#endif
+  }
+
+  // StdPeriph word loop, MPEG-2 of words, not of byte stream
+  best = 0xFFFFFFFF;
+  for (int i = 0; i < CRC_RUNS; i++)
+  {
+    t = DWT->CYCCNT;
+    PROF_CRC_Begin(&PROF_CRC_32_MPEG2);
+    r = CRC_CalcBlockCRC(buf, size / 4);
+    t = DWT->CYCCNT - t;
+    if (t < best)
+      best = t;
+  }
+  DEBUG_PRINTF("%-30s|%9u |%9.2f | 0x%08X\r\n", "CRC_CalcBlockCRC words", (unsigned)best, (float)best / size, (unsigned)r);
+
+  DEBUG_PRINTF("Check \"123456789\":\r\n");
+  for (int m = 0; m < (int)(sizeof(crc_models) / sizeof(crc_models[0])); m++)
+  {
+    cfg = crc_models[m];
+    PROF_CRC_Begin(cfg);
+    crc_feed(check, 4);      // split stream, unaligned second part
+    crc_feed(check + 4, 5);
+    r = PROF_CRC_End();
+    DEBUG_PRINTF("%-20s: 0x%08X %s\r\n", cfg->name, (unsigned)r,
+                 (r == cfg->check && PROF_CRC_Soft(cfg, check, 9) == cfg->check) ? "ok" : "FAIL");
+  }
+  DEBUG_PRINTF("\r\n");
+}
+
+#endif // PROFILING_CRC
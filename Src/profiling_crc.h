@@ -0,0 +1,48 @@
+#ifndef _PROFILING_CRC_H
+#define _PROFILING_CRC_H
+
+#include "profiling.h"
+#include "profiling_dma.h"
+
+/**
+ * Streaming CRC on hardware CRC unit, any byte length and alignment.
+ * CRC model parameters as in CRC catalogue: poly and init not reflected,
+ * reflect applies to input and output.
+ */
+#if PROFILING_CRC
+
+typedef struct
+{
+  const char *name;
+  uint32_t   poly;
+  uint32_t   init;
+  uint32_t   xorout;
+  uint32_t   check;     // CRC of "123456789"
+  uint8_t    size;      // 7, 8, 16 or 32 bits
+  uint8_t    reflect;
+} PROF_CRC_Config_t;
+
+extern const PROF_CRC_Config_t PROF_CRC_32;         // zlib, Ethernet
+extern const PROF_CRC_Config_t PROF_CRC_32_MPEG2;   // CRC unit reset default
+extern const PROF_CRC_Config_t PROF_CRC_16_CCITT;
+extern const PROF_CRC_Config_t PROF_CRC_16_MODBUS;
+extern const PROF_CRC_Config_t PROF_CRC_8;
+extern const PROF_CRC_Config_t PROF_CRC_7_MMC;
+
+void     PROF_CRC_Begin(const PROF_CRC_Config_t *cfg);
+void     PROF_CRC_Update(const void *data, uint32_t size);
+uint32_t PROF_CRC_End(void);
+uint32_t PROF_CRC_Calc(const PROF_CRC_Config_t *cfg, const void *data, uint32_t size);
+uint32_t PROF_CRC_Soft(const PROF_CRC_Config_t *cfg, const void *data, uint32_t size);
+void     PROF_CRC_Bench(void *buf, uint32_t size);
+#if PROFILING_DMA
+uint8_t  PROF_CRC_UpdateDMA(const void *data, uint32_t size, PROF_DMA_Callback done, void *arg);
+#endif
+
+#else
+
+#define PROF_CRC_Bench(b, s) ((void)0)
+
+#endif // PROFILING_CRC
+
+#endif // _PROFILING_CRC_H
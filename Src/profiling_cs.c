@@ -0,0 +1,188 @@
+/***********************************************************************
+ File Name    : 'profiling_cs.c'
+ Title        : PROFILER
+ Description  : Critical section duration tracker.
+                Measure every interrupt-masked window (PRIMASK or
+                BASEPRI) with DWT_CYCCNT and keep the longest
+                PROFILING_CS_TOP_COUNT of them with call-site address.
+
+                Examle output:
+                Critical sections: 1520 total, longest 3:
+                --Site--------|-Mask----|----cycles--|---time------
+                0x08000A1C    : PRIMASK |       1210 |       16 us
+                0x08000B40    : BASEPRI |        388 |        5 us
+                0x08000A1C    : PRIMASK |        301 |        4 us
+
+ Target MCU   : STM32
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_cs.h"
+
+#if PROFILING_CS_TRACE
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+
+typedef struct
+{
+  uint32_t cycles;  // masked window length
+  uint32_t site;    // address of the code that masked interrupts
+  uint8_t  basepri; // 0 - PRIMASK, 1 - BASEPRI
+} cs_record_t;
+
+/* Private variables -------------------------------------------------*/
+static uint32_t    primask_start;  // PRIMASK window start time
+static uint32_t    primask_site;
+static uint8_t     primask_open;   // window opened by PROF_CS_DisableIRQ()
+static uint32_t    basepri_start;  // BASEPRI window start time
+static uint32_t    basepri_site;
+static uint32_t    cs_total;       // closed windows counter
+static cs_record_t cs_top[PROFILING_CS_TOP_COUNT]; // sorted, longest first
+
+/* Private function prototypes ---------------------------------------*/
+static void cs_record(uint32_t cycles, uint32_t site, uint8_t basepri);
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Insert window into the top list. Called with interrupts masked
+ */
+static void cs_record(uint32_t cycles, uint32_t site, uint8_t basepri)
+{
+  int i;
+
+  cs_total++;
+  if (cycles <= cs_top[PROFILING_CS_TOP_COUNT - 1].cycles)
+    return;
+
+  for (i = PROFILING_CS_TOP_COUNT - 1; i > 0 && cs_top[i - 1].cycles < cycles; i--)
+    cs_top[i] = cs_top[i - 1];
+
+  cs_top[i].cycles = cycles;
+  cs_top[i].site = site;
+  cs_top[i].basepri = basepri;
+}
+
+
+/**
+ * @brief Instrumented __disable_irq(). Only the outermost call opens window
+ */
+void PROF_CS_DisableIRQ(void)
+{
+  if (__get_PRIMASK())
+    return;
+
+  __disable_irq();
+  primask_site = PROF_RETURN_ADDRESS();
+  primask_open = 1;
+  primask_start = DWT->CYCCNT;
+}
+
+
+/**
+ * @brief Instrumented __enable_irq(). Close window and enable interrupts.
+ *        Masking by raw __disable_irq() is no window, its start is unknown
+ */
+void PROF_CS_EnableIRQ(void)
+{
+  uint32_t cycles;
+
+  if (__get_PRIMASK() && primask_open)
+  {
+    cycles = DWT->CYCCNT - primask_start;
+    cs_record(cycles, primask_site, 0);
+  }
+  primask_open = 0;
+  __enable_irq();
+}
+
+
+/**
+ * @brief Instrumented __set_BASEPRI(). Window is open while BASEPRI != 0
+ *
+ * @param basepri New BASEPRI value
+ */
+void PROF_CS_SetBASEPRI(uint32_t basepri)
+{
+  uint32_t old = __get_BASEPRI();
+  uint32_t now = DWT->CYCCNT;
+  uint32_t primask;
+
+  if (old == 0 && basepri != 0)
+  {
+    __set_BASEPRI(basepri);
+    basepri_site = PROF_RETURN_ADDRESS();
+    basepri_start = now;
+  }
+  else if (old != 0 && basepri == 0)
+  {
+    // higher priority interrupts may record PRIMASK windows meanwhile
+    primask = __get_PRIMASK();
+    __disable_irq();
+    cs_record(now - basepri_start, basepri_site, 1);
+    if (!primask)
+      __enable_irq();
+    __set_BASEPRI(basepri);
+  }
+  else
+  {
+    __set_BASEPRI(basepri);
+  }
+}
+
+
+/**
+ * @brief Clear statistic. Called from PROFILING_START
+ */
+void PROF_CS_Reset(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  cs_total = 0;
+  for (int i = 0; i < PROFILING_CS_TOP_COUNT; i++)
+    cs_top[i].cycles = 0;
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Print longest critical sections to ITM Stimulus Port 0
+ */
+void PROF_CS_Report(void)
+{
+  cs_record_t top[PROFILING_CS_TOP_COUNT];
+  uint32_t total;
+  uint32_t primask;
+  int32_t tick_per_1us;
+  int count;
+
+  tick_per_1us = SystemCoreClock / 1000000;
+
+  // take a consistent copy, printing is too slow to do it masked
+  primask = __get_PRIMASK();
+  __disable_irq();
+  total = cs_total;
+  for (count = 0; count < PROFILING_CS_TOP_COUNT; count++)
+    top[count] = cs_top[count];
+  if (!primask)
+    __enable_irq();
+
+  for (count = 0; count < PROFILING_CS_TOP_COUNT && top[count].cycles; count++);
+
+  DEBUG_PRINTF("Critical sections: %u total, longest %d:\r\n"
+               "--Site--------|-Mask----|----cycles--|---time------\r\n", (unsigned)total, count);
+  for (int i = 0; i < count; i++)
+  {
+    DEBUG_PRINTF("0x%08X    : %s | %10u | %9u us\r\n",
+                 (unsigned)top[i].site, top[i].basepri ? "BASEPRI" : "PRIMASK",
+                 (unsigned)top[i].cycles, (unsigned)(top[i].cycles / tick_per_1us));
+  }
+  DEBUG_PRINTF("\r\n");
+}
+
+#endif // PROFILING_CS_TRACE
@@ -0,0 +1,34 @@
+#ifndef _PROFILING_CS_H
+#define _PROFILING_CS_H
+
+#include "profiling.h"
+
+/**
+ * Critical section wrappers.
+ * Use instead of __disable_irq()/__enable_irq()/__set_BASEPRI().
+ * With PROFILING_CS_TRACE == 0 they are the plain CMSIS intrinsics.
+ */
+#if PROFILING_CS_TRACE
+
+#define PROF_DISABLE_IRQ()      PROF_CS_DisableIRQ()
+#define PROF_ENABLE_IRQ()       PROF_CS_EnableIRQ()
+#define PROF_SET_BASEPRI(x)     PROF_CS_SetBASEPRI(x)
+
+void PROF_CS_DisableIRQ(void);
+void PROF_CS_EnableIRQ(void);
+void PROF_CS_SetBASEPRI(uint32_t basepri);
+void PROF_CS_Reset(void);
+void PROF_CS_Report(void);
+
+#else
+
+#define PROF_DISABLE_IRQ()      __disable_irq()
+#define PROF_ENABLE_IRQ()       __enable_irq()
+#define PROF_SET_BASEPRI(x)     __set_BASEPRI(x)
+
+#define PROF_CS_Reset()         ((void)0)
+#define PROF_CS_Report()        ((void)0)
+
+#endif // PROFILING_CS_TRACE
+
+#endif // _PROFILING_CS_H
@@ -0,0 +1,262 @@
+/***********************************************************************
+ File Name    : 'profiling_ctx.c'
+ Title        : PROFILER
+ Description  : Context switch tracing.
+                Switch hooks accumulate CPU time per context, count
+                switches and measure response time (PROF_CTX_Ready()
+                to switch in). Last PROFILING_SWITCH_TRACE switches
+                are kept in ring with DWT_CYCCNT timestamps.
+
+                Examle output:
+                Contexts:
+                --Context---------------------|-switches-|---CPU time---|--CPU--|--max resp---
+                idle                          :      120 |     812345 us |  81.2% |        0 us
+                control                       :      100 |     150021 us |  15.0% |       12 us
+                comm                          :       20 |      37634 us |   3.8% |      240 us
+
+ Target MCU   : STM32
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_ctx.h"
+
+#if PROFILING_CONTEXT_COUNT > 1
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+
+typedef struct
+{
+  const char *name;
+  uint64_t   run_cycles;  // accumulated CPU time
+  uint32_t   switch_in;   // CYCCNT at last switch in
+  uint32_t   switches;    // switch in counter
+  uint32_t   ready_time;  // CYCCNT at PROF_CTX_Ready()
+  uint32_t   resp_max;    // max response time, cycles
+  uint8_t    ready;
+} ctx_stat_t;
+
+typedef struct
+{
+  uint32_t time;
+  uint8_t  ctx;
+  uint8_t  in;            // 1 - switch in, 0 - switch out
+} ctx_trace_t;
+
+/* Private variables -------------------------------------------------*/
+volatile uint8_t   PROF_CTX_current;
+static ctx_stat_t  ctx_stat[PROFILING_CONTEXT_COUNT];
+static ctx_trace_t ctx_trace[PROFILING_SWITCH_TRACE];
+static uint16_t    trace_pos;   // next write position
+static uint16_t    trace_count;
+
+/* Private function prototypes ---------------------------------------*/
+static void ctx_trace_add(uint32_t time, uint8_t ctx, uint8_t in);
+/* -------------------------------------------------------------------*/
+
+
+static void ctx_trace_add(uint32_t time, uint8_t ctx, uint8_t in)
+{
+  ctx_trace[trace_pos].time = time;
+  ctx_trace[trace_pos].ctx = ctx;
+  ctx_trace[trace_pos].in = in;
+  if (++trace_pos >= PROFILING_SWITCH_TRACE)
+    trace_pos = 0;
+  if (trace_count < PROFILING_SWITCH_TRACE)
+    trace_count++;
+}
+
+
+/**
+ * @brief Set context name for reports
+ *
+ * @param ctx  Context number
+ * @param name Context name
+ */
+void PROF_CTX_SetName(uint8_t ctx, const char *name)
+{
+  if (ctx < PROFILING_CONTEXT_COUNT)
+    ctx_stat[ctx].name = name;
+}
+
+
+/**
+ * @brief Context became ready to run. Start of response time
+ *
+ * @param ctx Context number
+ */
+void PROF_CTX_Ready(uint8_t ctx)
+{
+  if (ctx >= PROFILING_CONTEXT_COUNT || ctx_stat[ctx].ready)
+    return;
+
+  ctx_stat[ctx].ready_time = DWT->CYCCNT;
+  ctx_stat[ctx].ready = 1;
+}
+
+
+/**
+ * @brief Current context leaves CPU
+ */
+void PROF_CTX_SwitchOut(void)
+{
+  uint32_t now = DWT->CYCCNT;
+  ctx_stat_t *c = &ctx_stat[PROF_CTX_current];
+
+  c->run_cycles += now - c->switch_in;
+  ctx_trace_add(now, PROF_CTX_current, 0);
+}
+
+
+/**
+ * @brief Context gets CPU. Profiling sessions switch to this context
+ *
+ * @param ctx Context number
+ */
+void PROF_CTX_SwitchIn(uint8_t ctx)
+{
+  uint32_t now = DWT->CYCCNT;
+  ctx_stat_t *c;
+  uint32_t resp;
+
+  if (ctx >= PROFILING_CONTEXT_COUNT)
+    return;
+
+  c = &ctx_stat[ctx];
+  PROF_CTX_current = ctx;
+  c->switch_in = now;
+  c->switches++;
+  if (c->ready)
+  {
+    resp = now - c->ready_time;
+    if (resp > c->resp_max)
+      c->resp_max = resp;
+    c->ready = 0;
+  }
+  ctx_trace_add(now, ctx, 1);
+}
+
+
+/**
+ * @brief Switch out current and switch in next context
+ *
+ * @param next Next context number
+ */
+void PROF_CTX_Switch(uint8_t next)
+{
+  PROF_CTX_SwitchOut();
+  PROF_CTX_SwitchIn(next);
+}
+
+
+/**
+ * @brief Clear statistic and trace, keep context names
+ */
+void PROF_CTX_Reset(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  for (int i = 0; i < PROFILING_CONTEXT_COUNT; i++)
+  {
+    ctx_stat[i].run_cycles = 0;
+    ctx_stat[i].switches = 0;
+    ctx_stat[i].resp_max = 0;
+    ctx_stat[i].ready = 0;
+  }
+  ctx_stat[PROF_CTX_current].switch_in = DWT->CYCCNT;
+  trace_pos = 0;
+  trace_count = 0;
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Print per-context CPU time and response time to ITM Stimulus Port 0
+ */
+void PROF_CTX_Report(void)
+{
+  ctx_stat_t stat[PROFILING_CONTEXT_COUNT];
+  uint32_t primask;
+  uint32_t tick_per_1us;
+  uint64_t total = 0;
+  uint32_t permille;
+
+  tick_per_1us = SystemCoreClock / 1000000;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  // include running time of current context
+  ctx_stat[PROF_CTX_current].run_cycles += DWT->CYCCNT - ctx_stat[PROF_CTX_current].switch_in;
+  ctx_stat[PROF_CTX_current].switch_in = DWT->CYCCNT;
+  for (int i = 0; i < PROFILING_CONTEXT_COUNT; i++)
+    stat[i] = ctx_stat[i];
+  if (!primask)
+    __enable_irq();
+
+  for (int i = 0; i < PROFILING_CONTEXT_COUNT; i++)
+    total += stat[i].run_cycles;
+  if (total == 0)
+    total = 1;
+
+  DEBUG_PRINTF("Contexts:\r\n"
+               "--Context---------------------|-switches-|---CPU time---|--CPU--|--max resp---\r\n");
+  for (int i = 0; i < PROFILING_CONTEXT_COUNT; i++)
+  {
+    permille = (uint32_t)(stat[i].run_cycles * 1000 / total);
+    if (stat[i].name)
+      DEBUG_PRINTF("%-30s:", stat[i].name);
+    else
+      DEBUG_PRINTF("context %-22d:", i);
+    DEBUG_PRINTF(" %8u | %10u us | %3u.%u%% | %8u us\r\n",
+                 (unsigned)stat[i].switches, (unsigned)(stat[i].run_cycles / tick_per_1us),
+                 (unsigned)(permille / 10), (unsigned)(permille % 10),
+                 (unsigned)(stat[i].resp_max / tick_per_1us));
+  }
+  DEBUG_PRINTF("\r\n");
+}
+
+
+/**
+ * @brief Print last context switches to ITM Stimulus Port 0
+ */
+void PROF_CTX_TraceReport(void)
+{
+  ctx_trace_t trace[PROFILING_SWITCH_TRACE];
+  uint32_t primask;
+  uint32_t tick_per_1us;
+  int count, pos;
+
+  tick_per_1us = SystemCoreClock / 1000000;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  count = trace_count;
+  pos = (trace_pos + PROFILING_SWITCH_TRACE - trace_count) % PROFILING_SWITCH_TRACE;
+  for (int i = 0; i < count; i++)
+  {
+    trace[i] = ctx_trace[pos];
+    if (++pos >= PROFILING_SWITCH_TRACE)
+      pos = 0;
+  }
+  if (!primask)
+    __enable_irq();
+
+  DEBUG_PRINTF("Context switches:\r\n"
+               "--Context---------------------|-dir-|--timestamp--\r\n");
+  for (int i = 0; i < count; i++)
+  {
+    if (ctx_stat[trace[i].ctx].name)
+      DEBUG_PRINTF("%-30s:", ctx_stat[trace[i].ctx].name);
+    else
+      DEBUG_PRINTF("context %-22d:", trace[i].ctx);
+    DEBUG_PRINTF(" %s | %+9d us\r\n", trace[i].in ? " in" : "out",
+                 (int)((int32_t)(trace[i].time - trace[0].time) / (int32_t)tick_per_1us));
+  }
+  DEBUG_PRINTF("\r\n");
+}
+
+#endif // PROFILING_CONTEXT_COUNT
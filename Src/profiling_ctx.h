@@ -0,0 +1,42 @@
+#ifndef _PROFILING_CTX_H
+#define _PROFILING_CTX_H
+
+#include "profiling.h"
+
+/**
+ * Per-context sessions and context switch hooks.
+ * Each context (task) has own PROFILING_START/EVENT/STOP session.
+ * Scheduler calls PROF_CTX_Switch() (e.g. from PendSV_Handler) or
+ * the PROF_CTX_SwitchOut()/PROF_CTX_SwitchIn() pair, and optionally
+ * PROF_CTX_Ready() when task is released, for response time.
+ * Context 0 is the one running after reset.
+ */
+#if PROFILING_CONTEXT_COUNT > 1
+
+extern volatile uint8_t PROF_CTX_current;
+#define PROF_CTX_CURRENT()      (PROF_CTX_current)
+
+void PROF_CTX_SetName(uint8_t ctx, const char *name);
+void PROF_CTX_Ready(uint8_t ctx);
+void PROF_CTX_SwitchOut(void);
+void PROF_CTX_SwitchIn(uint8_t ctx);
+void PROF_CTX_Switch(uint8_t next);
+void PROF_CTX_Reset(void);
+void PROF_CTX_Report(void);
+void PROF_CTX_TraceReport(void);
+
+#else
+
+#define PROF_CTX_CURRENT()      (0)
+#define PROF_CTX_SetName(c, n)  ((void)0)
+#define PROF_CTX_Ready(c)       ((void)0)
+#define PROF_CTX_SwitchOut()    ((void)0)
+#define PROF_CTX_SwitchIn(c)    ((void)0)
+#define PROF_CTX_Switch(n)      ((void)0)
+#define PROF_CTX_Reset()        ((void)0)
+#define PROF_CTX_Report()       ((void)0)
+#define PROF_CTX_TraceReport()  ((void)0)
+
+#endif // PROFILING_CONTEXT_COUNT
+
+#endif // _PROFILING_CTX_H
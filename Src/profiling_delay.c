@@ -0,0 +1,182 @@
+/***********************************************************************
+ File Name    : 'profiling_delay.c'
+ Title        : PROFILER
+ Description  : DWT cycle counter delay, timeout and tickless time base.
+                Delays count cycles from the CYCCNT value read on entry,
+                unsigned difference makes them wrap safe, error is the
+                call overhead (~10 cycles) instead of up to 1 ms of
+                a SysTick spin. PROF_DELAY_ms() advances its reference
+                by exactly 1 ms per step, so long delays do not drift.
+                PROF_DELAY_Now() is CYCCNT extended to 64 bit, it has to
+                be called at least once per 2^32 cycles: PROF_DELAY_Tick()
+                from SysTick_Handler does it.
+                PROFILING_TICKLESS: SysTick period is 2^24 cycles
+                (233 ms at 72 MHz) instead of 1 ms, PROF_DELAY_Sleep_ms()
+                reprograms it as one shot wakeup and busy waits the last
+                PROFILING_DELAY_SPIN_US. Load meter windows and RTC resync
+                need the 1 kHz tick and stop in tickless mode.
+                DBG_SLEEP is set so CYCCNT keeps counting in WFI.
+
+ Target MCU   : STM32F30x
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_delay.h"
+#include "profiling_load.h"
+
+#if PROFILING_DELAY
+
+/* Private Definitions -----------------------------------------------*/
+#define TICKLESS_PERIOD   (SysTick_LOAD_RELOAD_Msk + 1)
+
+/* Private variables -------------------------------------------------*/
+static uint32_t cyc_high;     // CYCCNT wraps
+static uint32_t cyc_last;     // CYCCNT at last PROF_DELAY_Now()
+
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Enable cycle counter, with PROFILING_TICKLESS start SysTick
+ *        as 2^24 cycle wrap keeper
+ */
+void PROF_DELAY_Init(void)
+{
+  PROF_CYCCNT_ENABLE();
+  DBGMCU->CR |= DBGMCU_CR_DBG_SLEEP;
+  cyc_last = DWT->CYCCNT;
+#if PROFILING_TICKLESS
+  SysTick_Config(TICKLESS_PERIOD);
+#endif
+}
+
+
+/**
+ * @brief Keep 64 bit time base. Call from SysTick_Handler
+ */
+void PROF_DELAY_Tick(void)
+{
+  PROF_DELAY_Now();
+}
+
+
+/**
+ * @brief CYCCNT extended to 64 bit. CYCCNT is not zeroed, time base
+ *        starts at its value on PROF_DELAY_Init()
+ *
+ * @return Cycles, low 32 bit equal to DWT->CYCCNT
+ */
+uint64_t PROF_DELAY_Now(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t now, high;
+
+  __disable_irq();
+  now = DWT->CYCCNT;
+  if (now < cyc_last)
+    cyc_high++;
+  cyc_last = now;
+  high = cyc_high;
+  if (!primask)
+    __enable_irq();
+  return ((uint64_t)high << 32) | now;
+}
+
+
+/**
+ * @brief Milliseconds from 64 bit time base, replaces Tick
+ */
+uint32_t PROF_DELAY_Millis(void)
+{
+  return (uint32_t)(PROF_DELAY_Now() / (SystemCoreClock / 1000));
+}
+
+
+/**
+ * @brief Busy wait
+ *
+ * @param cycles Core clock cycles, up to 2^32 - 1
+ */
+void PROF_DELAY_Cycles(uint32_t cycles)
+{
+  uint32_t t0 = DWT->CYCCNT;
+
+  while (DWT->CYCCNT - t0 < cycles);
+}
+
+
+/**
+ * @brief Busy wait
+ *
+ * @param us Microseconds, up to 2^32 cycles
+ */
+void PROF_DELAY_us(uint32_t us)
+{
+  uint32_t t0 = DWT->CYCCNT;
+  uint32_t cycles = us * (SystemCoreClock / 1000000);
+
+  while (DWT->CYCCNT - t0 < cycles);
+}
+
+
+/**
+ * @brief Busy wait, any length
+ *
+ * @param ms Milliseconds
+ */
+void PROF_DELAY_ms(uint32_t ms)
+{
+  uint32_t t0 = DWT->CYCCNT;
+  uint32_t per_ms = SystemCoreClock / 1000;
+
+  while (ms--)
+  {
+    while (DWT->CYCCNT - t0 < per_ms);
+    t0 += per_ms;
+  }
+}
+
+
+/**
+ * @brief Sleep in WFI, busy wait last PROFILING_DELAY_SPIN_US.
+ *        Call with interrupts enabled
+ *
+ * @param ms Milliseconds
+ */
+void PROF_DELAY_Sleep_ms(uint32_t ms)
+{
+  uint32_t spin = PROFILING_DELAY_SPIN_US * (SystemCoreClock / 1000000);
+  uint64_t deadline = PROF_DELAY_Now() + (uint64_t)ms * (SystemCoreClock / 1000);
+  uint64_t now, left;
+
+  while ((now = PROF_DELAY_Now()) < deadline)
+  {
+    left = deadline - now;
+    if (left < 2 * spin)
+    {
+      PROF_DELAY_Cycles((uint32_t)left);
+      break;
+    }
+    // masked until WFI: one shot can not fire before sleep
+    __disable_irq();
+#if PROFILING_TICKLESS
+    // one shot wakeup spin cycles before deadline
+    left -= spin;
+    SysTick->LOAD = (left > TICKLESS_PERIOD ? TICKLESS_PERIOD : (uint32_t)left) - 1;
+    SysTick->VAL = 0;
+#endif
+#if PROFILING_LOAD_METER
+    PROF_LOAD_Idle();
+#else
+    __WFI();
+    __enable_irq();
+#endif
+#if PROFILING_TICKLESS
+    SysTick->LOAD = TICKLESS_PERIOD - 1;  // from next reload
+#endif
+  }
+}
+
+#endif // PROFILING_DELAY
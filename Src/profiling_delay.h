@@ -0,0 +1,60 @@
+#ifndef _PROFILING_DELAY_H
+#define _PROFILING_DELAY_H
+
+#include "profiling.h"
+
+/**
+ * Busy wait delays and timeouts on DWT_CYCCNT, wrap safe.
+ * Single delay or timeout up to 2^32 cycles (59 s at 72 MHz).
+ * PROF_DELAY_Tick() from SysTick_Handler extends CYCCNT to 64 bit,
+ * with PROFILING_TICKLESS SysTick runs only as wrap keeper and as
+ * one shot wakeup of PROF_DELAY_Sleep_ms().
+ */
+#if PROFILING_TICKLESS && !PROFILING_DELAY
+#error "PROFILING_TICKLESS needs PROFILING_DELAY (SysTick is started by PROF_DELAY_Init)"
+#endif
+
+#if PROFILING_DELAY
+
+typedef struct
+{
+  uint32_t start;
+  uint32_t cycles;
+} PROF_DELAY_Timeout_t;
+
+void     PROF_DELAY_Init(void);
+void     PROF_DELAY_Tick(void);
+void     PROF_DELAY_Cycles(uint32_t cycles);
+void     PROF_DELAY_us(uint32_t us);
+void     PROF_DELAY_ms(uint32_t ms);
+void     PROF_DELAY_Sleep_ms(uint32_t ms);
+uint64_t PROF_DELAY_Now(void);     // CYCCNT extended to 64 bit, not zeroed
+uint32_t PROF_DELAY_Millis(void);
+
+/**
+ * @brief Start timeout of us microseconds
+ */
+__STATIC_INLINE void PROF_DELAY_Start(PROF_DELAY_Timeout_t *t, uint32_t us)
+{
+  t->start = DWT->CYCCNT;
+  t->cycles = us * (SystemCoreClock / 1000000);
+}
+
+/**
+ * @brief Wrap safe timeout check
+ *
+ * @return 1 if timeout elapsed
+ */
+__STATIC_INLINE uint8_t PROF_DELAY_Expired(const PROF_DELAY_Timeout_t *t)
+{
+  return (DWT->CYCCNT - t->start) >= t->cycles;
+}
+
+#else
+
+#define PROF_DELAY_Init()       ((void)0)
+#define PROF_DELAY_Tick()       ((void)0)
+
+#endif // PROFILING_DELAY
+
+#endif // _PROFILING_DELAY_H
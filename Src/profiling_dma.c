@@ -0,0 +1,516 @@
+/***********************************************************************
+ File Name    : 'profiling_dma.c'
+ Title        : PROFILER
+ Description  : DMA memcpy/memset with measured CPU/DMA crossover.
+                PROF_DMA_Init() configures DMA1 channel PROFILING_DMA_CH
+                with DMA_Init() once, per transfer only CPAR, CMAR, CNDTR
+                and CCR are written (DMA_Init() per transfer would move
+                crossover up by ~100 cycles). Transfers are split in
+                65535 item chunks in DMA interrupt.
+                Word transfers when both addresses and size are 4 byte
+                aligned, else half word or byte: crossover is scaled by
+                4 / transfer width then.
+                PROF_DMA_Calibrate() times CPU memcpy() and blocking DMA
+                copy for 8 byte .. buffer size / 2 and sets crossover to
+                the first size DMA wins.
+                PROF_DMA_Feed() writes a buffer to one peripheral data
+                register (CRC->DR) with fixed transfer width.
+
+                Examle output:
+                DMA bench, 72000000 Hz, crossover 128 bytes:
+                --Size--|-----CPU-|-----DMA-
+                      8 |      36 |      83
+                     64 |      92 |     105
+                    128 |     170 |     137
+                   1024 |    1234 |     873
+                Bus contention, 1024 bytes DMA copy:
+                CPU read loop alone           :      520 cycles
+                CPU read loop during DMA      :      706 cycles (+35.8%)
+                DMA copy alone                :      873 cycles
+                DMA copy during CPU reads     :     1139 cycles (+30.5%)
+
+ Target MCU   : STM32F30x
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_dma.h"
+#include <string.h>
+
+#if PROFILING_DMA
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+
+#define DMA_PASTE(a, n, b)  a##n##b
+#define DMA_NAME(a, n, b)   DMA_PASTE(a, n, b)
+#define DMA_CHANNEL         DMA_NAME(DMA1_Channel, PROFILING_DMA_CH, )
+#define DMA_IRQn            DMA_NAME(DMA1_Channel, PROFILING_DMA_CH, _IRQn)
+#define DMA_IRQHandler      DMA_NAME(DMA1_Channel, PROFILING_DMA_CH, _IRQHandler)
+#define CH_IT_GL            DMA_NAME(DMA1_IT_GL, PROFILING_DMA_CH, )
+#define CH_IT_TC            DMA_NAME(DMA1_IT_TC, PROFILING_DMA_CH, )
+#define CH_IT_TE            DMA_NAME(DMA1_IT_TE, PROFILING_DMA_CH, )
+
+#define DMA_INC_SRC         0x01
+#define DMA_INC_DST         0x02
+
+#define DMA_MAX_ITEMS       0xFFFF
+#define DMA_CAL_SIZES       14    // 8 bytes .. 64 KB
+#define DMA_CAL_RUNS        3
+
+typedef struct
+{
+  volatile uint8_t  busy;
+  volatile uint8_t  error;
+  uint8_t           width;    // bytes per item 1, 2, 4
+  uint8_t           inc;      // DMA_INC_SRC, DMA_INC_DST
+  uint32_t          ccr;      // CCR of current transfer, EN cleared
+  uint32_t          src;      // next chunk
+  uint32_t          dst;
+  uint32_t          left;     // items after current chunk
+  uint32_t          fill;     // PROF_DMA_Set() source
+  uint32_t          t_start;  // CYCCNT at start
+  volatile uint32_t t_done;   // CYCCNT at completion interrupt
+  PROF_DMA_Callback done;
+  void              *arg;
+} dma_state_t;
+
+/* Private variables -------------------------------------------------*/
+static dma_state_t dma;
+static uint32_t ccr_base;                       // CCR after DMA_Init()
+static uint32_t crossover = PROFILING_DMA_CROSSOVER;
+static uint32_t cal_cpu[DMA_CAL_SIZES];         // cycles, PROF_DMA_Calibrate()
+static uint32_t cal_dma[DMA_CAL_SIZES];
+static uint8_t  cal_count;
+static uint8_t  dma_ready;                      // PROF_DMA_Init() done
+static volatile uint32_t sink;
+
+/* Private function prototypes ---------------------------------------*/
+static uint8_t  dma_claim(void);
+static void     dma_start(uint32_t dst, uint32_t src, uint32_t size, uint8_t width, uint8_t inc, uint8_t irq);
+static void     dma_chunk(void);
+static uint32_t dma_read_loop(const uint32_t *p, uint32_t words);
+void DMA_IRQHandler(void);
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Enable DMA1 clock, configure channel and its interrupt
+ */
+void PROF_DMA_Init(void)
+{
+  DMA_InitTypeDef  DMA_InitStructure;
+  NVIC_InitTypeDef NVIC_InitStructure;
+
+  RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+  DMA_DeInit(DMA_CHANNEL);
+
+  DMA_StructInit(&DMA_InitStructure);
+  DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralSRC;
+  DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Enable;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Word;
+  DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Word;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Normal;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_Medium;
+  DMA_InitStructure.DMA_M2M = DMA_M2M_Enable;
+  DMA_Init(DMA_CHANNEL, &DMA_InitStructure);
+  ccr_base = DMA_CHANNEL->CCR & ~(DMA_CCR_PINC | DMA_CCR_MINC | DMA_CCR_PSIZE | DMA_CCR_MSIZE);
+
+  NVIC_InitStructure.NVIC_IRQChannel = DMA_IRQn;
+  NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 0;
+  NVIC_InitStructure.NVIC_IRQChannelSubPriority = 2;
+  NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+  NVIC_Init(&NVIC_InitStructure);
+  dma_ready = 1;
+
+  PROF_CYCCNT_ENABLE();
+}
+
+
+/**
+ * @brief Channel configured, PROF_DMA_Init() was called
+ *
+ * @return 1 if transfers may go to DMA
+ */
+uint8_t PROF_DMA_Ready(void)
+{
+  return dma_ready;
+}
+
+
+/**
+ * @brief Take channel
+ *
+ * @return 0 if busy or not initialized
+ */
+static uint8_t dma_claim(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint8_t free;
+
+  __disable_irq();
+  free = dma_ready && !dma.busy;
+  if (free)
+    dma.busy = 1;
+  if (!primask)
+    __enable_irq();
+  return free;
+}
+
+
+/**
+ * @brief Program transfer and start first chunk
+ *
+ * @param width Bytes per item, 0 - widest the alignment allows
+ * @param inc   DMA_INC_SRC, DMA_INC_DST
+ */
+static void dma_start(uint32_t dst, uint32_t src, uint32_t size, uint8_t width, uint8_t inc, uint8_t irq)
+{
+  uint32_t align = dst | src | size;
+  uint32_t w = width ? width : (align & 3) == 0 ? 4 : (align & 1) == 0 ? 2 : 1;
+
+  dma.width = w;
+  dma.inc = inc;
+  dma.src = src;
+  dma.dst = dst;
+  dma.left = size / w;
+  dma.error = 0;
+  dma.ccr = ccr_base | ((w >> 1) << 8) | ((w >> 1) << 10) |  // PSIZE, MSIZE
+            ((inc & DMA_INC_SRC) ? DMA_CCR_PINC : 0) | ((inc & DMA_INC_DST) ? DMA_CCR_MINC : 0) |
+            (irq ? DMA_CCR_TCIE | DMA_CCR_TEIE : 0);
+  dma.t_start = DWT->CYCCNT;
+  dma_chunk();
+}
+
+
+/**
+ * @brief Start next chunk of at most DMA_MAX_ITEMS items
+ */
+static void dma_chunk(void)
+{
+  uint32_t n = (dma.left > DMA_MAX_ITEMS) ? DMA_MAX_ITEMS : dma.left;
+
+  DMA_CHANNEL->CCR = dma.ccr;
+  DMA1->IFCR = CH_IT_GL;
+  DMA_CHANNEL->CPAR = dma.src;
+  DMA_CHANNEL->CMAR = dma.dst;
+  DMA_CHANNEL->CNDTR = n;
+  dma.left -= n;
+  if (dma.inc & DMA_INC_DST)
+    dma.dst += n * dma.width;
+  if (dma.inc & DMA_INC_SRC)
+    dma.src += n * dma.width;
+  DMA_CHANNEL->CCR = dma.ccr | DMA_CCR_EN;
+}
+
+
+/**
+ * @brief Transfer complete or error: next chunk or completion callback
+ */
+void DMA_IRQHandler(void)
+{
+  uint32_t isr = DMA1->ISR;
+
+  DMA1->IFCR = CH_IT_GL;
+  if (isr & CH_IT_TE)
+    dma.error = 1;
+  else if (!(isr & CH_IT_TC))
+    return;
+
+  if (!dma.error && dma.left)
+  {
+    dma_chunk();
+    return;
+  }
+
+  DMA_CHANNEL->CCR = dma.ccr;
+  dma.t_done = DWT->CYCCNT;
+  dma.busy = 0;
+  if (dma.done)
+    dma.done(dma.arg, dma.error);
+}
+
+
+/**
+ * @brief Copy memory, DMA if size is above crossover and channel is free
+ *
+ * @param dst  Destination, SRAM (CCM RAM is not accessible by DMA)
+ * @param src  Source, SRAM or flash
+ * @param size Bytes
+ * @param done Completion callback or NULL, called from DMA interrupt
+ * @param arg  Callback argument
+ * @return PROF_DMA_CPU or PROF_DMA_STARTED
+ */
+uint8_t PROF_DMA_Copy(void *dst, const void *src, uint32_t size, PROF_DMA_Callback done, void *arg)
+{
+  uint32_t align = (uint32_t)dst | (uint32_t)src | size;
+  uint32_t scaled = (align & 3) == 0 ? size : (align & 1) == 0 ? size / 2 : size / 4;
+
+  if (size == 0 || scaled < crossover || !dma_claim())
+  {
+    memcpy(dst, src, size);
+    if (done)
+      done(arg, 0);
+    return PROF_DMA_CPU;
+  }
+
+  dma.done = done;
+  dma.arg = arg;
+  dma_start((uint32_t)dst, (uint32_t)src, size, 0, DMA_INC_SRC | DMA_INC_DST, 1);
+  return PROF_DMA_STARTED;
+}
+
+
+/**
+ * @brief Fill memory, DMA if size is above crossover and channel is free
+ *
+ * @return PROF_DMA_CPU or PROF_DMA_STARTED
+ */
+uint8_t PROF_DMA_Set(void *dst, uint8_t value, uint32_t size, PROF_DMA_Callback done, void *arg)
+{
+  uint32_t align = (uint32_t)dst | size;
+  uint32_t scaled = (align & 3) == 0 ? size : (align & 1) == 0 ? size / 2 : size / 4;
+
+  if (size == 0 || scaled < crossover || !dma_claim())
+  {
+    memset(dst, value, size);
+    if (done)
+      done(arg, 0);
+    return PROF_DMA_CPU;
+  }
+
+  dma.done = done;
+  dma.arg = arg;
+  dma.fill = value * 0x01010101u;
+  dma_start((uint32_t)dst, (uint32_t)&dma.fill, size, 0, DMA_INC_DST, 1);
+  return PROF_DMA_STARTED;
+}
+
+
+/**
+ * @brief Write buffer to peripheral data register, no crossover check
+ *
+ * @param reg   Data register, not incremented
+ * @param src   Source, SRAM or flash, width aligned
+ * @param size  Bytes, multiple of width
+ * @param width Bytes per register write 1, 2, 4
+ * @param done  Completion callback or NULL, called from DMA interrupt
+ * @param arg   Callback argument
+ * @return PROF_DMA_CPU if channel is busy, or PROF_DMA_STARTED
+ */
+uint8_t PROF_DMA_Feed(volatile void *reg, const void *src, uint32_t size, uint8_t width, PROF_DMA_Callback done, void *arg)
+{
+  uint32_t i;
+
+  if (size == 0 || !dma_claim())
+  {
+    for (i = 0; i < size; i += width)
+    {
+      if (width == 4)
+        *(volatile uint32_t *)reg = *(const uint32_t *)((const uint8_t *)src + i);
+      else if (width == 2)
+        *(volatile uint16_t *)reg = *(const uint16_t *)((const uint8_t *)src + i);
+      else
+        *(volatile uint8_t *)reg = *((const uint8_t *)src + i);
+    }
+    if (done)
+      done(arg, 0);
+    return PROF_DMA_CPU;
+  }
+
+  dma.done = done;
+  dma.arg = arg;
+  dma_start((uint32_t)reg, (uint32_t)src, size, width, DMA_INC_SRC, 1);
+  return PROF_DMA_STARTED;
+}
+
+
+/**
+ * @brief Poll for completion
+ *
+ * @return 1 while transfer is running
+ */
+uint8_t PROF_DMA_Busy(void)
+{
+  return dma.busy;
+}
+
+
+/**
+ * @brief Wait for completion, sleeps in thread mode with interrupts
+ *        enabled. Polls if interrupts are masked or in an interrupt
+ *        handler (DMA interrupt may not preempt it, e.g. done callback)
+ */
+void PROF_DMA_Wait(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  if (primask || __get_IPSR() != 0)
+  {
+    // flags checked and cleared masked, not taken twice with DMA IRQ
+    while (dma.busy)
+    {
+      __disable_irq();
+      if (DMA1->ISR & (CH_IT_TC | CH_IT_TE))
+        DMA_IRQHandler();
+      if (!primask)
+        __enable_irq();
+    }
+    return;
+  }
+
+  // busy checked masked: completion IRQ pends and wakes WFI, not lost
+  // between the check and sleep
+  __disable_irq();
+  while (dma.busy)
+  {
+    __WFI();
+    __enable_irq();
+    __disable_irq();
+  }
+  __enable_irq();
+}
+
+
+/**
+ * @brief Measure CPU and DMA copy, set crossover. Interrupts are masked
+ *
+ * @param buf  Scratch buffer in SRAM, 4 byte aligned, contents destroyed
+ * @param size Buffer size, copies up to size / 2 are measured
+ * @return Crossover in bytes, 0xFFFFFFFF if CPU always wins
+ */
+uint32_t PROF_DMA_Calibrate(void *buf, uint32_t size)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint8_t *src = buf;
+  uint8_t *dst = src + size / 2;
+  uint32_t n, t, cpu, dmat;
+  int i;
+
+  if (!dma_ready)
+    return crossover;
+  PROF_DMA_Wait();
+  crossover = 0xFFFFFFFF;
+  __disable_irq();
+
+  for (i = 0, n = 8; i < DMA_CAL_SIZES && n <= size / 2; i++, n *= 2)
+  {
+    cpu = dmat = 0xFFFFFFFF;
+    for (int r = 0; r < DMA_CAL_RUNS; r++)
+    {
+      t = DWT->CYCCNT;
+      memcpy(dst, src, n);
+      t = DWT->CYCCNT - t;
+      if (t < cpu)
+        cpu = t;
+
+      // PROF_DMA_Copy() path, completion by polling
+      t = DWT->CYCCNT;
+      dma_claim();
+      dma_start((uint32_t)dst, (uint32_t)src, n, 0, DMA_INC_SRC | DMA_INC_DST, 0);
+      while (!(DMA1->ISR & (CH_IT_TC | CH_IT_TE)));
+      DMA1->IFCR = CH_IT_GL;
+      DMA_CHANNEL->CCR = dma.ccr;
+      dma.busy = 0;
+      t = DWT->CYCCNT - t;
+      if (t < dmat)
+        dmat = t;
+    }
+
+    cal_cpu[i] = cpu;
+    cal_dma[i] = dmat;
+    if (dmat < cpu && crossover == 0xFFFFFFFF)
+      crossover = n;
+    else if (dmat >= cpu)
+      crossover = 0xFFFFFFFF;  // CPU won again at larger size
+  }
+  cal_count = i;
+
+  if (!primask)
+    __enable_irq();
+  return crossover;
+}
+
+
+/**
+ * @brief Sum of words, SRAM read load
+ */
+static uint32_t dma_read_loop(const uint32_t *p, uint32_t words)
+{
+  uint32_t s = 0;
+
+  for (uint32_t i = 0; i < words; i++)
+    s += p[i];
+  return s;
+}
+
+
+/**
+ * @brief Calibrate, print crossover table and bus contention of CPU
+ *        reads and DMA copy to ITM Stimulus Port 0. Needs interrupts
+ *
+ * @param buf  Scratch buffer in SRAM, 4 byte aligned, contents destroyed
+ * @param size Buffer size
+ */
+void PROF_DMA_Bench(void *buf, uint32_t size)
+{
+  uint32_t *src = buf;
+  uint32_t half = size / 2 & ~3u;
+  uint32_t cpu_alone, cpu_dma, dma_alone, dma_cpu;
+  uint8_t early;
+  uint32_t t;
+  int i;
+
+  if (!dma_ready)
+  {
+    DEBUG_PRINTF("DMA bench: PROF_DMA_Init() not called\r\n\r\n");
+    return;
+  }
+  PROF_DMA_Calibrate(buf, size);
+
+  DEBUG_PRINTF("DMA bench, %u Hz, crossover ", (unsigned)SystemCoreClock);
+  if (crossover == 0xFFFFFFFF)
+    DEBUG_PRINTF("none, CPU always faster:\r\n");
+  else
+    DEBUG_PRINTF("%u bytes:\r\n", (unsigned)crossover);
+  DEBUG_PRINTF("--Size--|-----CPU-|-----DMA-\r\n");
+  for (i = 0; i < cal_count; i++)
+    DEBUG_PRINTF("%7u |%8u |%8u\r\n", 8u << i, (unsigned)cal_cpu[i], (unsigned)cal_dma[i]);
+
+  // CPU reads quarter of DMA source while DMA copies half buffer
+  t = DWT->CYCCNT;
+  sink = dma_read_loop(src, half / 16);
+  cpu_alone = DWT->CYCCNT - t;
+
+  dma_claim();
+  dma.done = NULL;
+  dma_start((uint32_t)src + half, (uint32_t)src, half, 0, DMA_INC_SRC | DMA_INC_DST, 1);
+  t = DWT->CYCCNT;
+  sink = dma_read_loop(src, half / 16);
+  cpu_dma = DWT->CYCCNT - t;
+  early = !dma.busy;
+  PROF_DMA_Wait();
+
+  dma_claim();
+  dma_start((uint32_t)src + half, (uint32_t)src, half, 0, DMA_INC_SRC | DMA_INC_DST, 1);
+  PROF_DMA_Wait();
+  dma_alone = dma.t_done - dma.t_start;
+
+  dma_claim();
+  dma_start((uint32_t)src + half, (uint32_t)src, half, 0, DMA_INC_SRC | DMA_INC_DST, 1);
+  while (dma.busy)
+    sink = dma_read_loop(src, 16);
+  dma_cpu = dma.t_done - dma.t_start;
+
+  DEBUG_PRINTF("Bus contention, %u bytes DMA copy:\r\n", (unsigned)half);
+  DEBUG_PRINTF("%-30s:%9u cycles\r\n", "CPU read loop alone", (unsigned)cpu_alone);
+  DEBUG_PRINTF("%-30s:%9u cycles (%+.1f%%)%s\r\n", "CPU read loop during DMA", (unsigned)cpu_dma,
+               100.0f * ((float)cpu_dma - cpu_alone) / cpu_alone, early ? ", DMA finished first" : "");
+  DEBUG_PRINTF("%-30s:%9u cycles\r\n", "DMA copy alone", (unsigned)dma_alone);
+  DEBUG_PRINTF("%-30s:%9u cycles (%+.1f%%)\r\n\r\n", "DMA copy during CPU reads", (unsigned)dma_cpu,
+               100.0f * ((float)dma_cpu - dma_alone) / dma_alone);
+}
+
+#endif // PROFILING_DMA
@@ -0,0 +1,36 @@
+#ifndef _PROFILING_DMA_H
+#define _PROFILING_DMA_H
+
+#include "profiling.h"
+
+/**
+ * Asynchronous memory copy and fill on DMA1 memory-to-memory channel.
+ * Transfers below the crossover size, while the channel is busy or before
+ * PROF_DMA_Init(), are done by CPU before return. PROF_DMA_Calibrate()
+ * measures crossover, until then PROFILING_DMA_CROSSOVER is used.
+ */
+#if PROFILING_DMA
+
+#define PROF_DMA_CPU      0   // done by CPU, callback already called
+#define PROF_DMA_STARTED  1   // DMA running, callback from DMA interrupt
+
+typedef void (*PROF_DMA_Callback)(void *arg, uint8_t error);
+
+void     PROF_DMA_Init(void);
+uint8_t  PROF_DMA_Ready(void);
+uint8_t  PROF_DMA_Copy(void *dst, const void *src, uint32_t size, PROF_DMA_Callback done, void *arg);
+uint8_t  PROF_DMA_Set(void *dst, uint8_t value, uint32_t size, PROF_DMA_Callback done, void *arg);
+uint8_t  PROF_DMA_Feed(volatile void *reg, const void *src, uint32_t size, uint8_t width, PROF_DMA_Callback done, void *arg);
+uint8_t  PROF_DMA_Busy(void);
+void     PROF_DMA_Wait(void);
+uint32_t PROF_DMA_Calibrate(void *buf, uint32_t size);
+void     PROF_DMA_Bench(void *buf, uint32_t size);
+
+#else
+
+#define PROF_DMA_Init()      ((void)0)
+#define PROF_DMA_Bench(b, s) ((void)0)
+
+#endif // PROFILING_DMA
+
+#endif // _PROFILING_DMA_H
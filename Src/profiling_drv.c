@@ -0,0 +1,174 @@
+/***********************************************************************
+ File Name    : 'profiling_drv.c'
+ Title        : PROFILER
+ Description  : StdPeriph driver call statistics.
+                Wrappers for every function of profiling_drv_list.h
+                (generated by Tools/drv_wrap_gen.py) are linked instead
+                of the driver function:
+                armcc - $Sub$$GPIO_Init calls $Super$$GPIO_Init
+                gcc   - __wrap_GPIO_Init calls __real_GPIO_Init, link
+                        with -Wl,--wrap=GPIO_Init (drv_wrap_gen.py --ld)
+                Calls and cycles are accumulated in open addressing hash
+                table of PROFILING_DRV_SLOTS entries keyed by name.
+                Wrappers of not used functions are removed by linker
+                (One ELF Section per Function / -ffunction-sections).
+
+                Examle output:
+                Driver calls: 6 functions
+                --Function--------------------|---calls--|-----cycles--|---time------
+                TIM_TimeBaseInit              :        1 |         104 |        1 us
+                GPIO_Init                     :        2 |          96 |        1 us
+
+ Target MCU   : STM32
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_drv.h"
+
+#if PROFILING_DRV_WRAP
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+
+#if PROFILING_DRV_SLOTS & (PROFILING_DRV_SLOTS - 1)
+#error "PROFILING_DRV_SLOTS must be power of 2"
+#elif PROFILING_DRV_SLOTS > 256
+#error "PROFILING_DRV_SLOTS too big"
+#endif
+
+// Fibonacci hash of name pointer
+#define DRV_HASH(p)     ((((uint32_t)(uintptr_t)(p) >> 2) * 2654435761u) >> 16)
+
+typedef struct
+{
+  const char *name;   // function name, NULL - free slot
+  uint32_t   calls;
+  uint64_t   cycles;
+} drv_slot_t;
+
+#if defined(__CC_ARM)
+#define DRV_SUB(f)      $Sub$$##f
+#define DRV_SUPER(f)    $Super$$##f
+#else
+#define DRV_SUB(f)      __wrap_##f
+#define DRV_SUPER(f)    __real_##f
+#endif
+
+#define PROF_DRV_V(f, params, args)                           \
+  extern void DRV_SUPER(f) params;                            \
+  void DRV_SUB(f) params                                      \
+  {                                                           \
+    uint32_t t0 = DWT->CYCCNT;                                \
+    DRV_SUPER(f) args;                                        \
+    PROF_DRV_Add(#f, DWT->CYCCNT - t0);                       \
+  }
+
+#define PROF_DRV_R(ret, f, params, args)                      \
+  extern ret DRV_SUPER(f) params;                             \
+  ret DRV_SUB(f) params                                       \
+  {                                                           \
+    uint32_t t0 = DWT->CYCCNT;                                \
+    ret r = DRV_SUPER(f) args;                                \
+    PROF_DRV_Add(#f, DWT->CYCCNT - t0);                       \
+    return r;                                                 \
+  }
+
+/* Private variables -------------------------------------------------*/
+static drv_slot_t drv_slot[PROFILING_DRV_SLOTS];
+static uint32_t   drv_lost;   // calls not counted, table full
+
+/* Wrappers ----------------------------------------------------------*/
+#include "profiling_drv_list.h"
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Count driver call. Called by wrappers, also from interrupts
+ *
+ * @param name   Function name
+ * @param cycles Call duration
+ */
+void PROF_DRV_Add(const char *name, uint32_t cycles)
+{
+  uint32_t i = DRV_HASH(name) & (PROFILING_DRV_SLOTS - 1);
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  for (int n = 0; n < PROFILING_DRV_SLOTS; n++)
+  {
+    if (drv_slot[i].name == name || drv_slot[i].name == NULL)
+    {
+      drv_slot[i].name = name;
+      drv_slot[i].calls++;
+      drv_slot[i].cycles += cycles;
+      if (!primask)
+        __enable_irq();
+      return;
+    }
+    i = (i + 1) & (PROFILING_DRV_SLOTS - 1);
+  }
+  drv_lost++;
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Clear table. Called from PROFILING_START
+ */
+void PROF_DRV_Reset(void)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  for (int i = 0; i < PROFILING_DRV_SLOTS; i++)
+  {
+    drv_slot[i].name = NULL;
+    drv_slot[i].calls = 0;
+    drv_slot[i].cycles = 0;
+  }
+  drv_lost = 0;
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Print driver functions, most expensive first
+ */
+void PROF_DRV_Report(void)
+{
+  uint8_t order[PROFILING_DRV_SLOTS];
+  int32_t tick_per_1us;
+  int count = 0;
+  int i, j;
+
+  tick_per_1us = SystemCoreClock / 1000000;
+
+  for (i = 0; i < PROFILING_DRV_SLOTS; i++)
+  {
+    if (drv_slot[i].name == NULL)
+      continue;
+    for (j = count; j > 0 && drv_slot[order[j - 1]].cycles < drv_slot[i].cycles; j--)
+      order[j] = order[j - 1];
+    order[j] = i;
+    count++;
+  }
+
+  DEBUG_PRINTF("Driver calls: %d functions\r\n"
+               "--Function--------------------|---calls--|-----cycles--|---time------\r\n", count);
+  for (i = 0; i < count; i++)
+  {
+    drv_slot_t *s = &drv_slot[order[i]];
+    DEBUG_PRINTF("%-30s: %8u | %11llu | %8llu us\r\n",
+                 s->name, (unsigned)s->calls, (unsigned long long)s->cycles,
+                 (unsigned long long)(s->cycles / tick_per_1us));
+  }
+  if (drv_lost)
+    DEBUG_PRINTF("Table full, %u calls lost, increase PROFILING_DRV_SLOTS\r\n", (unsigned)drv_lost);
+  DEBUG_PRINTF("\r\n");
+}
+
+#endif // PROFILING_DRV_WRAP
@@ -0,0 +1,26 @@
+#ifndef _PROFILING_DRV_H
+#define _PROFILING_DRV_H
+
+#include "profiling.h"
+
+/**
+ * StdPeriph driver call statistics.
+ * Every driver function listed in profiling_drv_list.h is patched at
+ * link time (armlink $Sub$$/$Super$$, GNU ld --wrap) with wrapper that
+ * counts calls and cycles, no source change needed. Nested driver calls
+ * are counted in both functions.
+ */
+#if PROFILING_DRV_WRAP
+
+void PROF_DRV_Add(const char *name, uint32_t cycles);
+void PROF_DRV_Reset(void);
+void PROF_DRV_Report(void);
+
+#else
+
+#define PROF_DRV_Reset()        ((void)0)
+#define PROF_DRV_Report()       ((void)0)
+
+#endif // PROFILING_DRV_WRAP
+
+#endif // _PROFILING_DRV_H
@@ -0,0 +1,734 @@
+/* Generated by Tools/drv_wrap_gen.py, do not edit */
+
+#ifdef __STM32F30x_ADC_H // stm32f30x_adc.h
+PROF_DRV_V(ADC_DeInit, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_V(ADC_Init, (ADC_TypeDef* ADCx, ADC_InitTypeDef* ADC_InitStruct), (ADCx, ADC_InitStruct))
+PROF_DRV_V(ADC_StructInit, (ADC_InitTypeDef* ADC_InitStruct), (ADC_InitStruct))
+PROF_DRV_V(ADC_InjectedInit, (ADC_TypeDef* ADCx, ADC_InjectedInitTypeDef* ADC_InjectedInitStruct), (ADCx, ADC_InjectedInitStruct))
+PROF_DRV_V(ADC_InjectedStructInit, (ADC_InjectedInitTypeDef* ADC_InjectedInitStruct), (ADC_InjectedInitStruct))
+PROF_DRV_V(ADC_CommonInit, (ADC_TypeDef* ADCx, ADC_CommonInitTypeDef* ADC_CommonInitStruct), (ADCx, ADC_CommonInitStruct))
+PROF_DRV_V(ADC_CommonStructInit, (ADC_CommonInitTypeDef* ADC_CommonInitStruct), (ADC_CommonInitStruct))
+PROF_DRV_V(ADC_Cmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_V(ADC_StartCalibration, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_R(uint32_t, ADC_GetCalibrationValue, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_V(ADC_SetCalibrationValue, (ADC_TypeDef* ADCx, uint32_t ADC_Calibration), (ADCx, ADC_Calibration))
+PROF_DRV_V(ADC_SelectCalibrationMode, (ADC_TypeDef* ADCx, uint32_t ADC_CalibrationMode), (ADCx, ADC_CalibrationMode))
+PROF_DRV_R(FlagStatus, ADC_GetCalibrationStatus, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_V(ADC_DisableCmd, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_R(FlagStatus, ADC_GetDisableCmdStatus, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_V(ADC_VoltageRegulatorCmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_V(ADC_SelectDifferentialMode, (ADC_TypeDef* ADCx, uint8_t ADC_Channel, FunctionalState NewState), (ADCx, ADC_Channel, NewState))
+PROF_DRV_V(ADC_SelectQueueOfContextMode, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_V(ADC_AutoDelayCmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_V(ADC_AnalogWatchdogCmd, (ADC_TypeDef* ADCx, uint32_t ADC_AnalogWatchdog), (ADCx, ADC_AnalogWatchdog))
+PROF_DRV_V(ADC_AnalogWatchdog1ThresholdsConfig, (ADC_TypeDef* ADCx, uint16_t HighThreshold, uint16_t LowThreshold), (ADCx, HighThreshold, LowThreshold))
+PROF_DRV_V(ADC_AnalogWatchdog2ThresholdsConfig, (ADC_TypeDef* ADCx, uint8_t HighThreshold, uint8_t LowThreshold), (ADCx, HighThreshold, LowThreshold))
+PROF_DRV_V(ADC_AnalogWatchdog3ThresholdsConfig, (ADC_TypeDef* ADCx, uint8_t HighThreshold, uint8_t LowThreshold), (ADCx, HighThreshold, LowThreshold))
+PROF_DRV_V(ADC_AnalogWatchdog1SingleChannelConfig, (ADC_TypeDef* ADCx, uint8_t ADC_Channel), (ADCx, ADC_Channel))
+PROF_DRV_V(ADC_AnalogWatchdog2SingleChannelConfig, (ADC_TypeDef* ADCx, uint8_t ADC_Channel), (ADCx, ADC_Channel))
+PROF_DRV_V(ADC_AnalogWatchdog3SingleChannelConfig, (ADC_TypeDef* ADCx, uint8_t ADC_Channel), (ADCx, ADC_Channel))
+PROF_DRV_V(ADC_TempSensorCmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_V(ADC_VrefintCmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_V(ADC_VbatCmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_V(ADC_RegularChannelConfig, (ADC_TypeDef* ADCx, uint8_t ADC_Channel, uint8_t Rank, uint8_t ADC_SampleTime), (ADCx, ADC_Channel, Rank, ADC_SampleTime))
+PROF_DRV_V(ADC_RegularChannelSequencerLengthConfig, (ADC_TypeDef* ADCx, uint8_t SequencerLength), (ADCx, SequencerLength))
+PROF_DRV_V(ADC_ExternalTriggerConfig, (ADC_TypeDef* ADCx, uint16_t ADC_ExternalTrigConvEvent, uint16_t ADC_ExternalTrigEventEdge), (ADCx, ADC_ExternalTrigConvEvent, ADC_ExternalTrigEventEdge))
+PROF_DRV_V(ADC_StartConversion, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_R(FlagStatus, ADC_GetStartConversionStatus, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_V(ADC_StopConversion, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_V(ADC_DiscModeChannelCountConfig, (ADC_TypeDef* ADCx, uint8_t Number), (ADCx, Number))
+PROF_DRV_V(ADC_DiscModeCmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_R(uint16_t, ADC_GetConversionValue, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_R(uint32_t, ADC_GetDualModeConversionValue, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_V(ADC_SetChannelOffset1, (ADC_TypeDef* ADCx, uint8_t ADC_Channel, uint16_t Offset), (ADCx, ADC_Channel, Offset))
+PROF_DRV_V(ADC_SetChannelOffset2, (ADC_TypeDef* ADCx, uint8_t ADC_Channel, uint16_t Offset), (ADCx, ADC_Channel, Offset))
+PROF_DRV_V(ADC_SetChannelOffset3, (ADC_TypeDef* ADCx, uint8_t ADC_Channel, uint16_t Offset), (ADCx, ADC_Channel, Offset))
+PROF_DRV_V(ADC_SetChannelOffset4, (ADC_TypeDef* ADCx, uint8_t ADC_Channel, uint16_t Offset), (ADCx, ADC_Channel, Offset))
+PROF_DRV_V(ADC_ChannelOffset1Cmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_V(ADC_ChannelOffset2Cmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_V(ADC_ChannelOffset3Cmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_V(ADC_ChannelOffset4Cmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_V(ADC_DMACmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_V(ADC_DMAConfig, (ADC_TypeDef* ADCx, uint32_t ADC_DMAMode), (ADCx, ADC_DMAMode))
+PROF_DRV_V(ADC_InjectedChannelSampleTimeConfig, (ADC_TypeDef* ADCx, uint8_t ADC_InjectedChannel, uint8_t ADC_SampleTime), (ADCx, ADC_InjectedChannel, ADC_SampleTime))
+PROF_DRV_V(ADC_StartInjectedConversion, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_R(FlagStatus, ADC_GetStartInjectedConversionStatus, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_V(ADC_StopInjectedConversion, (ADC_TypeDef* ADCx), (ADCx))
+PROF_DRV_V(ADC_AutoInjectedConvCmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_V(ADC_InjectedDiscModeCmd, (ADC_TypeDef* ADCx, FunctionalState NewState), (ADCx, NewState))
+PROF_DRV_R(uint16_t, ADC_GetInjectedConversionValue, (ADC_TypeDef* ADCx, uint8_t ADC_InjectedChannel), (ADCx, ADC_InjectedChannel))
+PROF_DRV_R(FlagStatus, ADC_GetCommonFlagStatus, (ADC_TypeDef* ADCx, uint32_t ADC_FLAG), (ADCx, ADC_FLAG))
+PROF_DRV_V(ADC_ClearCommonFlag, (ADC_TypeDef* ADCx, uint32_t ADC_FLAG), (ADCx, ADC_FLAG))
+PROF_DRV_V(ADC_ITConfig, (ADC_TypeDef* ADCx, uint32_t ADC_IT, FunctionalState NewState), (ADCx, ADC_IT, NewState))
+PROF_DRV_R(FlagStatus, ADC_GetFlagStatus, (ADC_TypeDef* ADCx, uint32_t ADC_FLAG), (ADCx, ADC_FLAG))
+PROF_DRV_V(ADC_ClearFlag, (ADC_TypeDef* ADCx, uint32_t ADC_FLAG), (ADCx, ADC_FLAG))
+PROF_DRV_R(ITStatus, ADC_GetITStatus, (ADC_TypeDef* ADCx, uint32_t ADC_IT), (ADCx, ADC_IT))
+PROF_DRV_V(ADC_ClearITPendingBit, (ADC_TypeDef* ADCx, uint32_t ADC_IT), (ADCx, ADC_IT))
+#endif
+
+#ifdef __STM32F30x_CAN_H // stm32f30x_can.h
+PROF_DRV_V(CAN_DeInit, (CAN_TypeDef* CANx), (CANx))
+PROF_DRV_R(uint8_t, CAN_Init, (CAN_TypeDef* CANx, CAN_InitTypeDef* CAN_InitStruct), (CANx, CAN_InitStruct))
+PROF_DRV_V(CAN_FilterInit, (CAN_FilterInitTypeDef* CAN_FilterInitStruct), (CAN_FilterInitStruct))
+PROF_DRV_V(CAN_StructInit, (CAN_InitTypeDef* CAN_InitStruct), (CAN_InitStruct))
+PROF_DRV_V(CAN_SlaveStartBank, (uint8_t CAN_BankNumber), (CAN_BankNumber))
+PROF_DRV_V(CAN_DBGFreeze, (CAN_TypeDef* CANx, FunctionalState NewState), (CANx, NewState))
+PROF_DRV_V(CAN_TTComModeCmd, (CAN_TypeDef* CANx, FunctionalState NewState), (CANx, NewState))
+PROF_DRV_R(uint8_t, CAN_Transmit, (CAN_TypeDef* CANx, CanTxMsg* TxMessage), (CANx, TxMessage))
+PROF_DRV_R(uint8_t, CAN_TransmitStatus, (CAN_TypeDef* CANx, uint8_t TransmitMailbox), (CANx, TransmitMailbox))
+PROF_DRV_V(CAN_CancelTransmit, (CAN_TypeDef* CANx, uint8_t Mailbox), (CANx, Mailbox))
+PROF_DRV_V(CAN_Receive, (CAN_TypeDef* CANx, uint8_t FIFONumber, CanRxMsg* RxMessage), (CANx, FIFONumber, RxMessage))
+PROF_DRV_V(CAN_FIFORelease, (CAN_TypeDef* CANx, uint8_t FIFONumber), (CANx, FIFONumber))
+PROF_DRV_R(uint8_t, CAN_MessagePending, (CAN_TypeDef* CANx, uint8_t FIFONumber), (CANx, FIFONumber))
+PROF_DRV_R(uint8_t, CAN_OperatingModeRequest, (CAN_TypeDef* CANx, uint8_t CAN_OperatingMode), (CANx, CAN_OperatingMode))
+PROF_DRV_R(uint8_t, CAN_Sleep, (CAN_TypeDef* CANx), (CANx))
+PROF_DRV_R(uint8_t, CAN_WakeUp, (CAN_TypeDef* CANx), (CANx))
+PROF_DRV_R(uint8_t, CAN_GetLastErrorCode, (CAN_TypeDef* CANx), (CANx))
+PROF_DRV_R(uint8_t, CAN_GetReceiveErrorCounter, (CAN_TypeDef* CANx), (CANx))
+PROF_DRV_R(uint8_t, CAN_GetLSBTransmitErrorCounter, (CAN_TypeDef* CANx), (CANx))
+PROF_DRV_V(CAN_ITConfig, (CAN_TypeDef* CANx, uint32_t CAN_IT, FunctionalState NewState), (CANx, CAN_IT, NewState))
+PROF_DRV_R(FlagStatus, CAN_GetFlagStatus, (CAN_TypeDef* CANx, uint32_t CAN_FLAG), (CANx, CAN_FLAG))
+PROF_DRV_V(CAN_ClearFlag, (CAN_TypeDef* CANx, uint32_t CAN_FLAG), (CANx, CAN_FLAG))
+PROF_DRV_R(ITStatus, CAN_GetITStatus, (CAN_TypeDef* CANx, uint32_t CAN_IT), (CANx, CAN_IT))
+PROF_DRV_V(CAN_ClearITPendingBit, (CAN_TypeDef* CANx, uint32_t CAN_IT), (CANx, CAN_IT))
+#endif
+
+#ifdef __STM32F30x_COMP_H // stm32f30x_comp.h
+PROF_DRV_V(COMP_DeInit, (uint32_t COMP_Selection), (COMP_Selection))
+PROF_DRV_V(COMP_Init, (uint32_t COMP_Selection, COMP_InitTypeDef* COMP_InitStruct), (COMP_Selection, COMP_InitStruct))
+PROF_DRV_V(COMP_StructInit, (COMP_InitTypeDef* COMP_InitStruct), (COMP_InitStruct))
+PROF_DRV_V(COMP_Cmd, (uint32_t COMP_Selection, FunctionalState NewState), (COMP_Selection, NewState))
+PROF_DRV_V(COMP_SwitchCmd, (uint32_t COMP_Selection, FunctionalState NewState), (COMP_Selection, NewState))
+PROF_DRV_R(uint32_t, COMP_GetOutputLevel, (uint32_t COMP_Selection), (COMP_Selection))
+PROF_DRV_V(COMP_WindowCmd, (uint32_t COMP_Selection, FunctionalState NewState), (COMP_Selection, NewState))
+PROF_DRV_V(COMP_LockConfig, (uint32_t COMP_Selection), (COMP_Selection))
+#endif
+
+#ifdef __STM32F30x_CRC_H // stm32f30x_crc.h
+PROF_DRV_V(CRC_DeInit, (void), ())
+PROF_DRV_V(CRC_ResetDR, (void), ())
+PROF_DRV_V(CRC_PolynomialSizeSelect, (uint32_t CRC_PolSize), (CRC_PolSize))
+PROF_DRV_V(CRC_ReverseInputDataSelect, (uint32_t CRC_ReverseInputData), (CRC_ReverseInputData))
+PROF_DRV_V(CRC_ReverseOutputDataCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(CRC_SetInitRegister, (uint32_t CRC_InitValue), (CRC_InitValue))
+PROF_DRV_V(CRC_SetPolynomial, (uint32_t CRC_Pol), (CRC_Pol))
+PROF_DRV_R(uint32_t, CRC_CalcCRC, (uint32_t CRC_Data), (CRC_Data))
+PROF_DRV_R(uint32_t, CRC_CalcCRC16bits, (uint16_t CRC_Data), (CRC_Data))
+PROF_DRV_R(uint32_t, CRC_CalcCRC8bits, (uint8_t CRC_Data), (CRC_Data))
+PROF_DRV_R(uint32_t, CRC_CalcBlockCRC, (uint32_t pBuffer[], uint32_t BufferLength), (pBuffer, BufferLength))
+PROF_DRV_R(uint32_t, CRC_GetCRC, (void), ())
+PROF_DRV_V(CRC_SetIDRegister, (uint8_t CRC_IDValue), (CRC_IDValue))
+PROF_DRV_R(uint8_t, CRC_GetIDRegister, (void), ())
+#endif
+
+#ifdef __STM32F30x_DAC_H // stm32f30x_dac.h
+PROF_DRV_V(DAC_DeInit, (DAC_TypeDef* DACx), (DACx))
+PROF_DRV_V(DAC_Init, (DAC_TypeDef* DACx, uint32_t DAC_Channel, DAC_InitTypeDef* DAC_InitStruct), (DACx, DAC_Channel, DAC_InitStruct))
+PROF_DRV_V(DAC_StructInit, (DAC_InitTypeDef* DAC_InitStruct), (DAC_InitStruct))
+PROF_DRV_V(DAC_Cmd, (DAC_TypeDef* DACx, uint32_t DAC_Channel, FunctionalState NewState), (DACx, DAC_Channel, NewState))
+PROF_DRV_V(DAC_SoftwareTriggerCmd, (DAC_TypeDef* DACx, uint32_t DAC_Channel, FunctionalState NewState), (DACx, DAC_Channel, NewState))
+PROF_DRV_V(DAC_DualSoftwareTriggerCmd, (DAC_TypeDef* DACx, FunctionalState NewState), (DACx, NewState))
+PROF_DRV_V(DAC_WaveGenerationCmd, (DAC_TypeDef* DACx, uint32_t DAC_Channel, uint32_t DAC_Wave, FunctionalState NewState), (DACx, DAC_Channel, DAC_Wave, NewState))
+PROF_DRV_V(DAC_SetChannel1Data, (DAC_TypeDef* DACx, uint32_t DAC_Align, uint16_t Data), (DACx, DAC_Align, Data))
+PROF_DRV_V(DAC_SetChannel2Data, (DAC_TypeDef* DACx, uint32_t DAC_Align, uint16_t Data), (DACx, DAC_Align, Data))
+PROF_DRV_V(DAC_SetDualChannelData, (DAC_TypeDef* DACx, uint32_t DAC_Align, uint16_t Data2, uint16_t Data1), (DACx, DAC_Align, Data2, Data1))
+PROF_DRV_R(uint16_t, DAC_GetDataOutputValue, (DAC_TypeDef* DACx, uint32_t DAC_Channel), (DACx, DAC_Channel))
+PROF_DRV_V(DAC_DMACmd, (DAC_TypeDef* DACx, uint32_t DAC_Channel, FunctionalState NewState), (DACx, DAC_Channel, NewState))
+PROF_DRV_V(DAC_ITConfig, (DAC_TypeDef* DACx, uint32_t DAC_Channel, uint32_t DAC_IT, FunctionalState NewState), (DACx, DAC_Channel, DAC_IT, NewState))
+PROF_DRV_R(FlagStatus, DAC_GetFlagStatus, (DAC_TypeDef* DACx, uint32_t DAC_Channel, uint32_t DAC_FLAG), (DACx, DAC_Channel, DAC_FLAG))
+PROF_DRV_V(DAC_ClearFlag, (DAC_TypeDef* DACx, uint32_t DAC_Channel, uint32_t DAC_FLAG), (DACx, DAC_Channel, DAC_FLAG))
+PROF_DRV_R(ITStatus, DAC_GetITStatus, (DAC_TypeDef* DACx, uint32_t DAC_Channel, uint32_t DAC_IT), (DACx, DAC_Channel, DAC_IT))
+PROF_DRV_V(DAC_ClearITPendingBit, (DAC_TypeDef* DACx, uint32_t DAC_Channel, uint32_t DAC_IT), (DACx, DAC_Channel, DAC_IT))
+#endif
+
+#ifdef __STM32F30x_DBGMCU_H // stm32f30x_dbgmcu.h
+PROF_DRV_R(uint32_t, DBGMCU_GetREVID, (void), ())
+PROF_DRV_R(uint32_t, DBGMCU_GetDEVID, (void), ())
+PROF_DRV_V(DBGMCU_Config, (uint32_t DBGMCU_Periph, FunctionalState NewState), (DBGMCU_Periph, NewState))
+PROF_DRV_V(DBGMCU_APB1PeriphConfig, (uint32_t DBGMCU_Periph, FunctionalState NewState), (DBGMCU_Periph, NewState))
+PROF_DRV_V(DBGMCU_APB2PeriphConfig, (uint32_t DBGMCU_Periph, FunctionalState NewState), (DBGMCU_Periph, NewState))
+#endif
+
+#ifdef __STM32F30x_DMA_H // stm32f30x_dma.h
+PROF_DRV_V(DMA_DeInit, (DMA_Channel_TypeDef* DMAy_Channelx), (DMAy_Channelx))
+PROF_DRV_V(DMA_Init, (DMA_Channel_TypeDef* DMAy_Channelx, DMA_InitTypeDef* DMA_InitStruct), (DMAy_Channelx, DMA_InitStruct))
+PROF_DRV_V(DMA_StructInit, (DMA_InitTypeDef* DMA_InitStruct), (DMA_InitStruct))
+PROF_DRV_V(DMA_Cmd, (DMA_Channel_TypeDef* DMAy_Channelx, FunctionalState NewState), (DMAy_Channelx, NewState))
+PROF_DRV_V(DMA_SetCurrDataCounter, (DMA_Channel_TypeDef* DMAy_Channelx, uint16_t DataNumber), (DMAy_Channelx, DataNumber))
+PROF_DRV_R(uint16_t, DMA_GetCurrDataCounter, (DMA_Channel_TypeDef* DMAy_Channelx), (DMAy_Channelx))
+PROF_DRV_V(DMA_ITConfig, (DMA_Channel_TypeDef* DMAy_Channelx, uint32_t DMA_IT, FunctionalState NewState), (DMAy_Channelx, DMA_IT, NewState))
+PROF_DRV_R(FlagStatus, DMA_GetFlagStatus, (uint32_t DMAy_FLAG), (DMAy_FLAG))
+PROF_DRV_V(DMA_ClearFlag, (uint32_t DMAy_FLAG), (DMAy_FLAG))
+PROF_DRV_R(ITStatus, DMA_GetITStatus, (uint32_t DMAy_IT), (DMAy_IT))
+PROF_DRV_V(DMA_ClearITPendingBit, (uint32_t DMAy_IT), (DMAy_IT))
+#endif
+
+#ifdef __STM32F30x_EXTI_H // stm32f30x_exti.h
+PROF_DRV_V(EXTI_DeInit, (void), ())
+PROF_DRV_V(EXTI_Init, (EXTI_InitTypeDef* EXTI_InitStruct), (EXTI_InitStruct))
+PROF_DRV_V(EXTI_StructInit, (EXTI_InitTypeDef* EXTI_InitStruct), (EXTI_InitStruct))
+PROF_DRV_V(EXTI_GenerateSWInterrupt, (uint32_t EXTI_Line), (EXTI_Line))
+PROF_DRV_R(FlagStatus, EXTI_GetFlagStatus, (uint32_t EXTI_Line), (EXTI_Line))
+PROF_DRV_V(EXTI_ClearFlag, (uint32_t EXTI_Line), (EXTI_Line))
+PROF_DRV_R(ITStatus, EXTI_GetITStatus, (uint32_t EXTI_Line), (EXTI_Line))
+PROF_DRV_V(EXTI_ClearITPendingBit, (uint32_t EXTI_Line), (EXTI_Line))
+#endif
+
+#ifdef __STM32F30x_FLASH_H // stm32f30x_flash.h
+PROF_DRV_V(FLASH_SetLatency, (uint32_t FLASH_Latency), (FLASH_Latency))
+PROF_DRV_V(FLASH_HalfCycleAccessCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(FLASH_PrefetchBufferCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(FLASH_Unlock, (void), ())
+PROF_DRV_V(FLASH_Lock, (void), ())
+PROF_DRV_R(FLASH_Status, FLASH_ErasePage, (uint32_t Page_Address), (Page_Address))
+PROF_DRV_R(FLASH_Status, FLASH_EraseAllPages, (void), ())
+PROF_DRV_R(FLASH_Status, FLASH_ProgramWord, (uint32_t Address, uint32_t Data), (Address, Data))
+PROF_DRV_R(FLASH_Status, FLASH_ProgramHalfWord, (uint32_t Address, uint16_t Data), (Address, Data))
+PROF_DRV_V(FLASH_OB_Unlock, (void), ())
+PROF_DRV_V(FLASH_OB_Lock, (void), ())
+PROF_DRV_V(FLASH_OB_Launch, (void), ())
+PROF_DRV_R(FLASH_Status, FLASH_OB_Erase, (void), ())
+PROF_DRV_R(FLASH_Status, FLASH_OB_EnableWRP, (uint32_t OB_WRP), (OB_WRP))
+PROF_DRV_R(FLASH_Status, FLASH_OB_RDPConfig, (uint8_t OB_RDP), (OB_RDP))
+PROF_DRV_R(FLASH_Status, FLASH_OB_UserConfig, (uint8_t OB_IWDG, uint8_t OB_STOP, uint8_t OB_STDBY), (OB_IWDG, OB_STOP, OB_STDBY))
+PROF_DRV_R(FLASH_Status, FLASH_OB_BOOTConfig, (uint8_t OB_BOOT1), (OB_BOOT1))
+PROF_DRV_R(FLASH_Status, FLASH_OB_VDDAConfig, (uint8_t OB_VDDA_ANALOG), (OB_VDDA_ANALOG))
+PROF_DRV_R(FLASH_Status, FLASH_OB_SRAMParityConfig, (uint8_t OB_SRAM_Parity), (OB_SRAM_Parity))
+PROF_DRV_R(FLASH_Status, FLASH_OB_WriteUser, (uint8_t OB_USER), (OB_USER))
+PROF_DRV_R(FLASH_Status, FLASH_ProgramOptionByteData, (uint32_t Address, uint8_t Data), (Address, Data))
+PROF_DRV_R(uint8_t, FLASH_OB_GetUser, (void), ())
+PROF_DRV_R(uint32_t, FLASH_OB_GetWRP, (void), ())
+PROF_DRV_R(FlagStatus, FLASH_OB_GetRDP, (void), ())
+PROF_DRV_V(FLASH_ITConfig, (uint32_t FLASH_IT, FunctionalState NewState), (FLASH_IT, NewState))
+PROF_DRV_R(FlagStatus, FLASH_GetFlagStatus, (uint32_t FLASH_FLAG), (FLASH_FLAG))
+PROF_DRV_V(FLASH_ClearFlag, (uint32_t FLASH_FLAG), (FLASH_FLAG))
+PROF_DRV_R(FLASH_Status, FLASH_GetStatus, (void), ())
+PROF_DRV_R(FLASH_Status, FLASH_WaitForLastOperation, (uint32_t Timeout), (Timeout))
+#endif
+
+#ifdef __STM32F30x_FMC_H // stm32f30x_fmc.h
+PROF_DRV_V(FMC_NORSRAMDeInit, (uint32_t FMC_Bank), (FMC_Bank))
+PROF_DRV_V(FMC_NORSRAMInit, (FMC_NORSRAMInitTypeDef* FMC_NORSRAMInitStruct), (FMC_NORSRAMInitStruct))
+PROF_DRV_V(FMC_NORSRAMStructInit, (FMC_NORSRAMInitTypeDef* FMC_NORSRAMInitStruct), (FMC_NORSRAMInitStruct))
+PROF_DRV_V(FMC_NORSRAMCmd, (uint32_t FMC_Bank, FunctionalState NewState), (FMC_Bank, NewState))
+PROF_DRV_V(FMC_NANDDeInit, (uint32_t FMC_Bank), (FMC_Bank))
+PROF_DRV_V(FMC_NANDInit, (FMC_NANDInitTypeDef* FMC_NANDInitStruct), (FMC_NANDInitStruct))
+PROF_DRV_V(FMC_NANDStructInit, (FMC_NANDInitTypeDef* FMC_NANDInitStruct), (FMC_NANDInitStruct))
+PROF_DRV_V(FMC_NANDCmd, (uint32_t FMC_Bank, FunctionalState NewState), (FMC_Bank, NewState))
+PROF_DRV_V(FMC_NANDECCCmd, (uint32_t FMC_Bank, FunctionalState NewState), (FMC_Bank, NewState))
+PROF_DRV_R(uint32_t, FMC_GetECC, (uint32_t FMC_Bank), (FMC_Bank))
+PROF_DRV_V(FMC_PCCARDDeInit, (void), ())
+PROF_DRV_V(FMC_PCCARDInit, (FMC_PCCARDInitTypeDef* FMC_PCCARDInitStruct), (FMC_PCCARDInitStruct))
+PROF_DRV_V(FMC_PCCARDStructInit, (FMC_PCCARDInitTypeDef* FMC_PCCARDInitStruct), (FMC_PCCARDInitStruct))
+PROF_DRV_V(FMC_PCCARDCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(FMC_ITConfig, (uint32_t FMC_Bank, uint32_t FMC_IT, FunctionalState NewState), (FMC_Bank, FMC_IT, NewState))
+PROF_DRV_R(FlagStatus, FMC_GetFlagStatus, (uint32_t FMC_Bank, uint32_t FMC_FLAG), (FMC_Bank, FMC_FLAG))
+PROF_DRV_V(FMC_ClearFlag, (uint32_t FMC_Bank, uint32_t FMC_FLAG), (FMC_Bank, FMC_FLAG))
+PROF_DRV_R(ITStatus, FMC_GetITStatus, (uint32_t FMC_Bank, uint32_t FMC_IT), (FMC_Bank, FMC_IT))
+PROF_DRV_V(FMC_ClearITPendingBit, (uint32_t FMC_Bank, uint32_t FMC_IT), (FMC_Bank, FMC_IT))
+#endif
+
+#ifdef __STM32F30x_GPIO_H // stm32f30x_gpio.h
+PROF_DRV_V(GPIO_DeInit, (GPIO_TypeDef* GPIOx), (GPIOx))
+PROF_DRV_V(GPIO_Init, (GPIO_TypeDef* GPIOx, GPIO_InitTypeDef* GPIO_InitStruct), (GPIOx, GPIO_InitStruct))
+PROF_DRV_V(GPIO_StructInit, (GPIO_InitTypeDef* GPIO_InitStruct), (GPIO_InitStruct))
+PROF_DRV_V(GPIO_PinLockConfig, (GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin), (GPIOx, GPIO_Pin))
+PROF_DRV_R(uint8_t, GPIO_ReadInputDataBit, (GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin), (GPIOx, GPIO_Pin))
+PROF_DRV_R(uint16_t, GPIO_ReadInputData, (GPIO_TypeDef* GPIOx), (GPIOx))
+PROF_DRV_R(uint8_t, GPIO_ReadOutputDataBit, (GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin), (GPIOx, GPIO_Pin))
+PROF_DRV_R(uint16_t, GPIO_ReadOutputData, (GPIO_TypeDef* GPIOx), (GPIOx))
+PROF_DRV_V(GPIO_SetBits, (GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin), (GPIOx, GPIO_Pin))
+PROF_DRV_V(GPIO_ResetBits, (GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin), (GPIOx, GPIO_Pin))
+PROF_DRV_V(GPIO_WriteBit, (GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, BitAction BitVal), (GPIOx, GPIO_Pin, BitVal))
+PROF_DRV_V(GPIO_Write, (GPIO_TypeDef* GPIOx, uint16_t PortVal), (GPIOx, PortVal))
+PROF_DRV_V(GPIO_PinAFConfig, (GPIO_TypeDef* GPIOx, uint16_t GPIO_PinSource, uint8_t GPIO_AF), (GPIOx, GPIO_PinSource, GPIO_AF))
+#endif
+
+#ifdef __STM32F30x_HRTIM_H // stm32f30x_hrtim.h
+PROF_DRV_V(HRTIM_SimpleBase_Init, (HRTIM_TypeDef* HRTIMx, uint32_t TimerIdx, HRTIM_BaseInitTypeDef* HRTIM_BaseInitStruct), (HRTIMx, TimerIdx, HRTIM_BaseInitStruct))
+PROF_DRV_V(HRTIM_DeInit, (HRTIM_TypeDef* HRTIMx), (HRTIMx))
+PROF_DRV_V(HRTIM_SimpleBaseStart, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx), (HRTIMx, TimerIdx))
+PROF_DRV_V(HRTIM_SimpleBaseStop, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx), (HRTIMx, TimerIdx))
+PROF_DRV_V(HRTIM_SimpleOC_Init, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, HRTIM_BaseInitTypeDef* HRTIM_BaseInitStruct), (HRTIMx, TimerIdx, HRTIM_BaseInitStruct))
+PROF_DRV_V(HRTIM_SimpleOCChannelConfig, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t OCChannel, HRTIM_BasicOCChannelCfgTypeDef* pBasicOCChannelCfg), (HRTIMx, TimerIdx, OCChannel, pBasicOCChannelCfg))
+PROF_DRV_V(HRTIM_SimpleOCStart, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t OCChannel), (HRTIMx, TimerIdx, OCChannel))
+PROF_DRV_V(HRTIM_SimpleOCStop, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t OCChannel), (HRTIMx, TimerIdx, OCChannel))
+PROF_DRV_V(HRTIM_SimplePWM_Init, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, HRTIM_BaseInitTypeDef* HRTIM_BaseInitStruct), (HRTIMx, TimerIdx, HRTIM_BaseInitStruct))
+PROF_DRV_V(HRTIM_SimplePWMChannelConfig, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t PWMChannel, HRTIM_BasicPWMChannelCfgTypeDef* pBasicPWMChannelCfg), (HRTIMx, TimerIdx, PWMChannel, pBasicPWMChannelCfg))
+PROF_DRV_V(HRTIM_SimplePWMStart, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t PWMChannel), (HRTIMx, TimerIdx, PWMChannel))
+PROF_DRV_V(HRTIM_SimplePWMStop, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t PWMChannel), (HRTIMx, TimerIdx, PWMChannel))
+PROF_DRV_V(HRTIM_SimpleCapture_Init, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, HRTIM_BaseInitTypeDef* HRTIM_BaseInitStruct), (HRTIMx, TimerIdx, HRTIM_BaseInitStruct))
+PROF_DRV_V(HRTIM_SimpleCaptureChannelConfig, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t CaptureChannel, HRTIM_BasicCaptureChannelCfgTypeDef* pBasicCaptureChannelCfg), (HRTIMx, TimerIdx, CaptureChannel, pBasicCaptureChannelCfg))
+PROF_DRV_V(HRTIM_SimpleCaptureStart, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t CaptureChannel), (HRTIMx, TimerIdx, CaptureChannel))
+PROF_DRV_V(HRTIM_SimpleCaptureStop, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t CaptureChannel), (HRTIMx, TimerIdx, CaptureChannel))
+PROF_DRV_V(HRTIM_SimpleOnePulse_Init, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, HRTIM_BaseInitTypeDef* HRTIM_BaseInitStruct), (HRTIMx, TimerIdx, HRTIM_BaseInitStruct))
+PROF_DRV_V(HRTIM_SimpleOnePulseChannelConfig, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t OnePulseChannel, HRTIM_BasicOnePulseChannelCfgTypeDef* pBasicOnePulseChannelCfg), (HRTIMx, TimerIdx, OnePulseChannel, pBasicOnePulseChannelCfg))
+PROF_DRV_V(HRTIM_SimpleOnePulseStart, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t OnePulseChannel), (HRTIMx, TimerIdx, OnePulseChannel))
+PROF_DRV_V(HRTIM_SimpleOnePulseStop, (HRTIM_TypeDef * HRTIM_, uint32_t TimerIdx, uint32_t OnePulseChannel), (HRTIM_, TimerIdx, OnePulseChannel))
+PROF_DRV_V(HRTIM_Waveform_Init, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, HRTIM_BaseInitTypeDef* HRTIM_BaseInitStruct, HRTIM_TimerInitTypeDef* HRTIM_TimerInitStruct), (HRTIMx, TimerIdx, HRTIM_BaseInitStruct, HRTIM_TimerInitStruct))
+PROF_DRV_V(HRTIM_WaveformTimerConfig, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, HRTIM_TimerCfgTypeDef * HRTIM_TimerCfgStruct), (HRTIMx, TimerIdx, HRTIM_TimerCfgStruct))
+PROF_DRV_V(HRTIM_WaveformCompareConfig, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t CompareUnit, HRTIM_CompareCfgTypeDef* pCompareCfg), (HRTIMx, TimerIdx, CompareUnit, pCompareCfg))
+PROF_DRV_V(HRTIM_SlaveSetCompare, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t CompareUnit, uint32_t Compare), (HRTIMx, TimerIdx, CompareUnit, Compare))
+PROF_DRV_V(HRTIM_MasterSetCompare, (HRTIM_TypeDef * HRTIMx, uint32_t CompareUnit, uint32_t Compare), (HRTIMx, CompareUnit, Compare))
+PROF_DRV_V(HRTIM_WaveformCaptureConfig, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t CaptureUnit, HRTIM_CaptureCfgTypeDef* pCaptureCfg), (HRTIMx, TimerIdx, CaptureUnit, pCaptureCfg))
+PROF_DRV_V(HRTIM_TimerEventFilteringConfig, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t Event, HRTIM_TimerEventFilteringCfgTypeDef * pTimerEventFilteringCfg), (HRTIMx, TimerIdx, Event, pTimerEventFilteringCfg))
+PROF_DRV_V(HRTIM_DeadTimeConfig, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, HRTIM_DeadTimeCfgTypeDef* pDeadTimeCfg), (HRTIMx, TimerIdx, pDeadTimeCfg))
+PROF_DRV_V(HRTIM_ChopperModeConfig, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, HRTIM_ChopperModeCfgTypeDef* pChopperModeCfg), (HRTIMx, TimerIdx, pChopperModeCfg))
+PROF_DRV_V(HRTIM_BurstDMAConfig, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t RegistersToUpdate), (HRTIMx, TimerIdx, RegistersToUpdate))
+PROF_DRV_V(HRTIM_SynchronizationConfig, (HRTIM_TypeDef *HRTIMx, HRTIM_SynchroCfgTypeDef * pSynchroCfg), (HRTIMx, pSynchroCfg))
+PROF_DRV_V(HRTIM_BurstModeConfig, (HRTIM_TypeDef *HRTIMx, HRTIM_BurstModeCfgTypeDef* pBurstModeCfg), (HRTIMx, pBurstModeCfg))
+PROF_DRV_V(HRTIM_EventConfig, (HRTIM_TypeDef *HRTIMx, uint32_t Event, HRTIM_EventCfgTypeDef* pEventCfg), (HRTIMx, Event, pEventCfg))
+PROF_DRV_V(HRTIM_EventPrescalerConfig, (HRTIM_TypeDef *HRTIMx, uint32_t Prescaler), (HRTIMx, Prescaler))
+PROF_DRV_V(HRTIM_FaultConfig, (HRTIM_TypeDef *hrtim, HRTIM_FaultCfgTypeDef* pFaultCfg, uint32_t Fault), (hrtim, pFaultCfg, Fault))
+PROF_DRV_V(HRTIM_FaultPrescalerConfig, (HRTIM_TypeDef *HRTIMx, uint32_t Prescaler), (HRTIMx, Prescaler))
+PROF_DRV_V(HRTIM_FaultModeCtl, (HRTIM_TypeDef * HRTIMx, uint32_t Fault, uint32_t Enable), (HRTIMx, Fault, Enable))
+PROF_DRV_V(HRTIM_ADCTriggerConfig, (HRTIM_TypeDef *HRTIMx, uint32_t ADCTrigger, HRTIM_ADCTriggerCfgTypeDef* pADCTriggerCfg), (HRTIMx, ADCTrigger, pADCTriggerCfg))
+PROF_DRV_V(HRTIM_WaveformCounterStart, (HRTIM_TypeDef *HRTIMx, uint32_t TimersToStart), (HRTIMx, TimersToStart))
+PROF_DRV_V(HRTIM_WaveformCounterStop, (HRTIM_TypeDef *HRTIMx, uint32_t TimersToStop), (HRTIMx, TimersToStop))
+PROF_DRV_V(HRTIM_WaveformOutputStart, (HRTIM_TypeDef *HRTIMx, uint32_t OutputsToStart), (HRTIMx, OutputsToStart))
+PROF_DRV_V(HRTIM_WaveformOutputStop, (HRTIM_TypeDef * HRTIM_, uint32_t OutputsToStop), (HRTIM_, OutputsToStop))
+PROF_DRV_V(HRTIM_DLLCalibrationStart, (HRTIM_TypeDef *HRTIMx, uint32_t CalibrationRate), (HRTIMx, CalibrationRate))
+PROF_DRV_V(HRTIM_ITConfig, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t HRTIM_TIM_IT, FunctionalState NewState), (HRTIMx, TimerIdx, HRTIM_TIM_IT, NewState))
+PROF_DRV_V(HRTIM_ITCommonConfig, (HRTIM_TypeDef * HRTIMx, uint32_t HRTIM_CommonIT, FunctionalState NewState), (HRTIMx, HRTIM_CommonIT, NewState))
+PROF_DRV_V(HRTIM_ClearFlag, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t HRTIM_FLAG), (HRTIMx, TimerIdx, HRTIM_FLAG))
+PROF_DRV_V(HRTIM_ClearCommonFlag, (HRTIM_TypeDef * HRTIMx, uint32_t HRTIM_CommonFLAG), (HRTIMx, HRTIM_CommonFLAG))
+PROF_DRV_V(HRTIM_ClearITPendingBit, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t HRTIM_IT), (HRTIMx, TimerIdx, HRTIM_IT))
+PROF_DRV_V(HRTIM_ClearCommonITPendingBit, (HRTIM_TypeDef * HRTIMx, uint32_t HRTIM_CommonIT), (HRTIMx, HRTIM_CommonIT))
+PROF_DRV_R(FlagStatus, HRTIM_GetFlagStatus, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t HRTIM_FLAG), (HRTIMx, TimerIdx, HRTIM_FLAG))
+PROF_DRV_R(FlagStatus, HRTIM_GetCommonFlagStatus, (HRTIM_TypeDef * HRTIMx, uint32_t HRTIM_CommonFLAG), (HRTIMx, HRTIM_CommonFLAG))
+PROF_DRV_R(ITStatus, HRTIM_GetITStatus, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t HRTIM_IT), (HRTIMx, TimerIdx, HRTIM_IT))
+PROF_DRV_R(ITStatus, HRTIM_GetCommonITStatus, (HRTIM_TypeDef * HRTIMx, uint32_t HRTIM_CommonIT), (HRTIMx, HRTIM_CommonIT))
+PROF_DRV_V(HRTIM_DMACmd, (HRTIM_TypeDef* HRTIMx, uint32_t TimerIdx, uint32_t HRTIM_DMA, FunctionalState NewState), (HRTIMx, TimerIdx, HRTIM_DMA, NewState))
+PROF_DRV_V(HRTIM_BurstModeCtl, (HRTIM_TypeDef *HRTIMx, uint32_t Enable), (HRTIMx, Enable))
+PROF_DRV_V(HRTIM_SoftwareCapture, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t CaptureUnit), (HRTIMx, TimerIdx, CaptureUnit))
+PROF_DRV_V(HRTIM_SoftwareUpdate, (HRTIM_TypeDef *HRTIMx, uint32_t TimersToUpdate), (HRTIMx, TimersToUpdate))
+PROF_DRV_V(HRTIM_SoftwareReset, (HRTIM_TypeDef *HRTIMx, uint32_t TimersToReset), (HRTIMx, TimersToReset))
+PROF_DRV_R(uint32_t, HRTIM_GetCapturedValue, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t CaptureUnit), (HRTIMx, TimerIdx, CaptureUnit))
+PROF_DRV_V(HRTIM_WaveformOutputConfig, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t Output, HRTIM_OutputCfgTypeDef * pOutputCfg), (HRTIMx, TimerIdx, Output, pOutputCfg))
+PROF_DRV_V(HRTIM_WaveformSetOutputLevel, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t Output, uint32_t OutputLevel), (HRTIMx, TimerIdx, Output, OutputLevel))
+PROF_DRV_R(uint32_t, HRTIM_WaveformGetOutputLevel, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t Output), (HRTIMx, TimerIdx, Output))
+PROF_DRV_R(uint32_t, HRTIM_WaveformGetOutputState, (HRTIM_TypeDef * HRTIMx, uint32_t TimerIdx, uint32_t Output), (HRTIMx, TimerIdx, Output))
+PROF_DRV_R(uint32_t, HRTIM_GetDelayedProtectionStatus, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx, uint32_t Output), (HRTIMx, TimerIdx, Output))
+PROF_DRV_R(uint32_t, HRTIM_GetBurstStatus, (HRTIM_TypeDef *HRTIMx), (HRTIMx))
+PROF_DRV_R(uint32_t, HRTIM_GetCurrentPushPullStatus, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx), (HRTIMx, TimerIdx))
+PROF_DRV_R(uint32_t, HRTIM_GetIdlePushPullStatus, (HRTIM_TypeDef *HRTIMx, uint32_t TimerIdx), (HRTIMx, TimerIdx))
+#endif
+
+#ifdef __STM32F30x_I2C_H // stm32f30x_i2c.h
+PROF_DRV_V(I2C_DeInit, (I2C_TypeDef* I2Cx), (I2Cx))
+PROF_DRV_V(I2C_Init, (I2C_TypeDef* I2Cx, I2C_InitTypeDef* I2C_InitStruct), (I2Cx, I2C_InitStruct))
+PROF_DRV_V(I2C_StructInit, (I2C_InitTypeDef* I2C_InitStruct), (I2C_InitStruct))
+PROF_DRV_V(I2C_Cmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_SoftwareResetCmd, (I2C_TypeDef* I2Cx), (I2Cx))
+PROF_DRV_V(I2C_ITConfig, (I2C_TypeDef* I2Cx, uint32_t I2C_IT, FunctionalState NewState), (I2Cx, I2C_IT, NewState))
+PROF_DRV_V(I2C_StretchClockCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_StopModeCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_DualAddressCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_OwnAddress2Config, (I2C_TypeDef* I2Cx, uint16_t Address, uint8_t Mask), (I2Cx, Address, Mask))
+PROF_DRV_V(I2C_GeneralCallCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_SlaveByteControlCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_SlaveAddressConfig, (I2C_TypeDef* I2Cx, uint16_t Address), (I2Cx, Address))
+PROF_DRV_V(I2C_10BitAddressingModeCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_AutoEndCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_ReloadCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_NumberOfBytesConfig, (I2C_TypeDef* I2Cx, uint8_t Number_Bytes), (I2Cx, Number_Bytes))
+PROF_DRV_V(I2C_MasterRequestConfig, (I2C_TypeDef* I2Cx, uint16_t I2C_Direction), (I2Cx, I2C_Direction))
+PROF_DRV_V(I2C_GenerateSTART, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_GenerateSTOP, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_10BitAddressHeaderCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_AcknowledgeConfig, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_R(uint8_t, I2C_GetAddressMatched, (I2C_TypeDef* I2Cx), (I2Cx))
+PROF_DRV_R(uint16_t, I2C_GetTransferDirection, (I2C_TypeDef* I2Cx), (I2Cx))
+PROF_DRV_V(I2C_TransferHandling, (I2C_TypeDef* I2Cx, uint16_t Address, uint8_t Number_Bytes, uint32_t ReloadEndMode, uint32_t StartStopMode), (I2Cx, Address, Number_Bytes, ReloadEndMode, StartStopMode))
+PROF_DRV_V(I2C_SMBusAlertCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_ClockTimeoutCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_ExtendedClockTimeoutCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_IdleClockTimeoutCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_TimeoutAConfig, (I2C_TypeDef* I2Cx, uint16_t Timeout), (I2Cx, Timeout))
+PROF_DRV_V(I2C_TimeoutBConfig, (I2C_TypeDef* I2Cx, uint16_t Timeout), (I2Cx, Timeout))
+PROF_DRV_V(I2C_CalculatePEC, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_V(I2C_PECRequestCmd, (I2C_TypeDef* I2Cx, FunctionalState NewState), (I2Cx, NewState))
+PROF_DRV_R(uint8_t, I2C_GetPEC, (I2C_TypeDef* I2Cx), (I2Cx))
+PROF_DRV_R(uint32_t, I2C_ReadRegister, (I2C_TypeDef* I2Cx, uint8_t I2C_Register), (I2Cx, I2C_Register))
+PROF_DRV_V(I2C_SendData, (I2C_TypeDef* I2Cx, uint8_t Data), (I2Cx, Data))
+PROF_DRV_R(uint8_t, I2C_ReceiveData, (I2C_TypeDef* I2Cx), (I2Cx))
+PROF_DRV_V(I2C_DMACmd, (I2C_TypeDef* I2Cx, uint32_t I2C_DMAReq, FunctionalState NewState), (I2Cx, I2C_DMAReq, NewState))
+PROF_DRV_R(FlagStatus, I2C_GetFlagStatus, (I2C_TypeDef* I2Cx, uint32_t I2C_FLAG), (I2Cx, I2C_FLAG))
+PROF_DRV_V(I2C_ClearFlag, (I2C_TypeDef* I2Cx, uint32_t I2C_FLAG), (I2Cx, I2C_FLAG))
+PROF_DRV_R(ITStatus, I2C_GetITStatus, (I2C_TypeDef* I2Cx, uint32_t I2C_IT), (I2Cx, I2C_IT))
+PROF_DRV_V(I2C_ClearITPendingBit, (I2C_TypeDef* I2Cx, uint32_t I2C_IT), (I2Cx, I2C_IT))
+#endif
+
+#ifdef __STM32F30x_IWDG_H // stm32f30x_iwdg.h
+PROF_DRV_V(IWDG_WriteAccessCmd, (uint16_t IWDG_WriteAccess), (IWDG_WriteAccess))
+PROF_DRV_V(IWDG_SetPrescaler, (uint8_t IWDG_Prescaler), (IWDG_Prescaler))
+PROF_DRV_V(IWDG_SetReload, (uint16_t Reload), (Reload))
+PROF_DRV_V(IWDG_ReloadCounter, (void), ())
+PROF_DRV_V(IWDG_SetWindowValue, (uint16_t WindowValue), (WindowValue))
+PROF_DRV_V(IWDG_Enable, (void), ())
+PROF_DRV_R(FlagStatus, IWDG_GetFlagStatus, (uint16_t IWDG_FLAG), (IWDG_FLAG))
+#endif
+
+#ifdef __STM32F30x_MISC_H // stm32f30x_misc.h
+PROF_DRV_V(NVIC_PriorityGroupConfig, (uint32_t NVIC_PriorityGroup), (NVIC_PriorityGroup))
+PROF_DRV_V(NVIC_Init, (NVIC_InitTypeDef* NVIC_InitStruct), (NVIC_InitStruct))
+PROF_DRV_V(NVIC_SetVectorTable, (uint32_t NVIC_VectTab, uint32_t Offset), (NVIC_VectTab, Offset))
+PROF_DRV_V(NVIC_SystemLPConfig, (uint8_t LowPowerMode, FunctionalState NewState), (LowPowerMode, NewState))
+PROF_DRV_V(SysTick_CLKSourceConfig, (uint32_t SysTick_CLKSource), (SysTick_CLKSource))
+#endif
+
+#ifdef __STM32F30x_OPAMP_H // stm32f30x_opamp.h
+PROF_DRV_V(OPAMP_DeInit, (uint32_t OPAMP_Selection), (OPAMP_Selection))
+PROF_DRV_V(OPAMP_Init, (uint32_t OPAMP_Selection, OPAMP_InitTypeDef* OPAMP_InitStruct), (OPAMP_Selection, OPAMP_InitStruct))
+PROF_DRV_V(OPAMP_StructInit, (OPAMP_InitTypeDef* OPAMP_InitStruct), (OPAMP_InitStruct))
+PROF_DRV_V(OPAMP_PGAConfig, (uint32_t OPAMP_Selection, uint32_t OPAMP_PGAGain, uint32_t OPAMP_PGAConnect), (OPAMP_Selection, OPAMP_PGAGain, OPAMP_PGAConnect))
+PROF_DRV_V(OPAMP_VrefConfig, (uint32_t OPAMP_Selection, uint32_t OPAMP_Vref), (OPAMP_Selection, OPAMP_Vref))
+PROF_DRV_V(OPAMP_VrefConnectADCCmd, (uint32_t OPAMP_Selection, FunctionalState NewState), (OPAMP_Selection, NewState))
+PROF_DRV_V(OPAMP_TimerControlledMuxConfig, (uint32_t OPAMP_Selection, OPAMP_InitTypeDef* OPAMP_InitStruct), (OPAMP_Selection, OPAMP_InitStruct))
+PROF_DRV_V(OPAMP_TimerControlledMuxCmd, (uint32_t OPAMP_Selection, FunctionalState NewState), (OPAMP_Selection, NewState))
+PROF_DRV_V(OPAMP_Cmd, (uint32_t OPAMP_Selection, FunctionalState NewState), (OPAMP_Selection, NewState))
+PROF_DRV_R(uint32_t, OPAMP_GetOutputLevel, (uint32_t OPAMP_Selection), (OPAMP_Selection))
+PROF_DRV_V(OPAMP_VrefConnectNonInvertingInput, (uint32_t OPAMP_Selection, FunctionalState NewState), (OPAMP_Selection, NewState))
+PROF_DRV_V(OPAMP_OffsetTrimModeSelect, (uint32_t OPAMP_Selection, uint32_t OPAMP_Trimming), (OPAMP_Selection, OPAMP_Trimming))
+PROF_DRV_V(OPAMP_OffsetTrimConfig, (uint32_t OPAMP_Selection, uint32_t OPAMP_Input, uint32_t OPAMP_TrimValue), (OPAMP_Selection, OPAMP_Input, OPAMP_TrimValue))
+PROF_DRV_V(OPAMP_StartCalibration, (uint32_t OPAMP_Selection, FunctionalState NewState), (OPAMP_Selection, NewState))
+PROF_DRV_V(OPAMP_LockConfig, (uint32_t OPAMP_Selection), (OPAMP_Selection))
+#endif
+
+#ifdef __STM32F30x_PWR_H // stm32f30x_pwr.h
+PROF_DRV_V(PWR_DeInit, (void), ())
+PROF_DRV_V(PWR_BackupAccessCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(PWR_PVDLevelConfig, (uint32_t PWR_PVDLevel), (PWR_PVDLevel))
+PROF_DRV_V(PWR_PVDCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(PWR_WakeUpPinCmd, (uint32_t PWR_WakeUpPin, FunctionalState NewState), (PWR_WakeUpPin, NewState))
+PROF_DRV_V(PWR_EnterSleepMode, (uint8_t PWR_SLEEPEntry), (PWR_SLEEPEntry))
+PROF_DRV_V(PWR_EnterSTOPMode, (uint32_t PWR_Regulator, uint8_t PWR_STOPEntry), (PWR_Regulator, PWR_STOPEntry))
+PROF_DRV_V(PWR_EnterSTANDBYMode, (void), ())
+PROF_DRV_R(FlagStatus, PWR_GetFlagStatus, (uint32_t PWR_FLAG), (PWR_FLAG))
+PROF_DRV_V(PWR_ClearFlag, (uint32_t PWR_FLAG), (PWR_FLAG))
+#endif
+
+#ifdef __STM32F30x_RCC_H // stm32f30x_rcc.h
+PROF_DRV_V(RCC_DeInit, (void), ())
+PROF_DRV_V(RCC_HSEConfig, (uint8_t RCC_HSE), (RCC_HSE))
+PROF_DRV_R(ErrorStatus, RCC_WaitForHSEStartUp, (void), ())
+PROF_DRV_V(RCC_AdjustHSICalibrationValue, (uint8_t HSICalibrationValue), (HSICalibrationValue))
+PROF_DRV_V(RCC_HSICmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(RCC_LSEConfig, (uint32_t RCC_LSE), (RCC_LSE))
+PROF_DRV_V(RCC_LSEDriveConfig, (uint32_t RCC_LSEDrive), (RCC_LSEDrive))
+PROF_DRV_V(RCC_LSICmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(RCC_PLLConfig, (uint32_t RCC_PLLSource, uint32_t RCC_PLLMul), (RCC_PLLSource, RCC_PLLMul))
+PROF_DRV_V(RCC_PLLCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(RCC_PREDIV1Config, (uint32_t RCC_PREDIV1_Div), (RCC_PREDIV1_Div))
+PROF_DRV_V(RCC_ClockSecuritySystemCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(RCC_SYSCLKConfig, (uint32_t RCC_SYSCLKSource), (RCC_SYSCLKSource))
+PROF_DRV_R(uint8_t, RCC_GetSYSCLKSource, (void), ())
+PROF_DRV_V(RCC_HCLKConfig, (uint32_t RCC_SYSCLK), (RCC_SYSCLK))
+PROF_DRV_V(RCC_PCLK1Config, (uint32_t RCC_HCLK), (RCC_HCLK))
+PROF_DRV_V(RCC_PCLK2Config, (uint32_t RCC_HCLK), (RCC_HCLK))
+PROF_DRV_V(RCC_GetClocksFreq, (RCC_ClocksTypeDef* RCC_Clocks), (RCC_Clocks))
+PROF_DRV_V(RCC_ADCCLKConfig, (uint32_t RCC_PLLCLK), (RCC_PLLCLK))
+PROF_DRV_V(RCC_I2CCLKConfig, (uint32_t RCC_I2CCLK), (RCC_I2CCLK))
+PROF_DRV_V(RCC_TIMCLKConfig, (uint32_t RCC_TIMCLK), (RCC_TIMCLK))
+PROF_DRV_V(RCC_HRTIM1CLKConfig, (uint32_t RCC_HRTIMCLK), (RCC_HRTIMCLK))
+PROF_DRV_V(RCC_I2SCLKConfig, (uint32_t RCC_I2SCLKSource), (RCC_I2SCLKSource))
+PROF_DRV_V(RCC_USARTCLKConfig, (uint32_t RCC_USARTCLK), (RCC_USARTCLK))
+PROF_DRV_V(RCC_USBCLKConfig, (uint32_t RCC_USBCLKSource), (RCC_USBCLKSource))
+PROF_DRV_V(RCC_RTCCLKConfig, (uint32_t RCC_RTCCLKSource), (RCC_RTCCLKSource))
+PROF_DRV_V(RCC_RTCCLKCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(RCC_BackupResetCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(RCC_AHBPeriphClockCmd, (uint32_t RCC_AHBPeriph, FunctionalState NewState), (RCC_AHBPeriph, NewState))
+PROF_DRV_V(RCC_APB2PeriphClockCmd, (uint32_t RCC_APB2Periph, FunctionalState NewState), (RCC_APB2Periph, NewState))
+PROF_DRV_V(RCC_APB1PeriphClockCmd, (uint32_t RCC_APB1Periph, FunctionalState NewState), (RCC_APB1Periph, NewState))
+PROF_DRV_V(RCC_AHBPeriphResetCmd, (uint32_t RCC_AHBPeriph, FunctionalState NewState), (RCC_AHBPeriph, NewState))
+PROF_DRV_V(RCC_APB2PeriphResetCmd, (uint32_t RCC_APB2Periph, FunctionalState NewState), (RCC_APB2Periph, NewState))
+PROF_DRV_V(RCC_APB1PeriphResetCmd, (uint32_t RCC_APB1Periph, FunctionalState NewState), (RCC_APB1Periph, NewState))
+PROF_DRV_V(RCC_ITConfig, (uint8_t RCC_IT, FunctionalState NewState), (RCC_IT, NewState))
+PROF_DRV_R(FlagStatus, RCC_GetFlagStatus, (uint8_t RCC_FLAG), (RCC_FLAG))
+PROF_DRV_V(RCC_ClearFlag, (void), ())
+PROF_DRV_R(ITStatus, RCC_GetITStatus, (uint8_t RCC_IT), (RCC_IT))
+PROF_DRV_V(RCC_ClearITPendingBit, (uint8_t RCC_IT), (RCC_IT))
+#endif
+
+#ifdef __STM32F30x_RTC_H // stm32f30x_rtc.h
+PROF_DRV_R(ErrorStatus, RTC_DeInit, (void), ())
+PROF_DRV_R(ErrorStatus, RTC_Init, (RTC_InitTypeDef* RTC_InitStruct), (RTC_InitStruct))
+PROF_DRV_V(RTC_StructInit, (RTC_InitTypeDef* RTC_InitStruct), (RTC_InitStruct))
+PROF_DRV_V(RTC_WriteProtectionCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_R(ErrorStatus, RTC_EnterInitMode, (void), ())
+PROF_DRV_V(RTC_ExitInitMode, (void), ())
+PROF_DRV_R(ErrorStatus, RTC_WaitForSynchro, (void), ())
+PROF_DRV_R(ErrorStatus, RTC_RefClockCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(RTC_BypassShadowCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_R(ErrorStatus, RTC_SetTime, (uint32_t RTC_Format, RTC_TimeTypeDef* RTC_TimeStruct), (RTC_Format, RTC_TimeStruct))
+PROF_DRV_V(RTC_TimeStructInit, (RTC_TimeTypeDef* RTC_TimeStruct), (RTC_TimeStruct))
+PROF_DRV_V(RTC_GetTime, (uint32_t RTC_Format, RTC_TimeTypeDef* RTC_TimeStruct), (RTC_Format, RTC_TimeStruct))
+PROF_DRV_R(uint32_t, RTC_GetSubSecond, (void), ())
+PROF_DRV_R(ErrorStatus, RTC_SetDate, (uint32_t RTC_Format, RTC_DateTypeDef* RTC_DateStruct), (RTC_Format, RTC_DateStruct))
+PROF_DRV_V(RTC_DateStructInit, (RTC_DateTypeDef* RTC_DateStruct), (RTC_DateStruct))
+PROF_DRV_V(RTC_GetDate, (uint32_t RTC_Format, RTC_DateTypeDef* RTC_DateStruct), (RTC_Format, RTC_DateStruct))
+PROF_DRV_V(RTC_SetAlarm, (uint32_t RTC_Format, uint32_t RTC_Alarm, RTC_AlarmTypeDef* RTC_AlarmStruct), (RTC_Format, RTC_Alarm, RTC_AlarmStruct))
+PROF_DRV_V(RTC_AlarmStructInit, (RTC_AlarmTypeDef* RTC_AlarmStruct), (RTC_AlarmStruct))
+PROF_DRV_V(RTC_GetAlarm, (uint32_t RTC_Format, uint32_t RTC_Alarm, RTC_AlarmTypeDef* RTC_AlarmStruct), (RTC_Format, RTC_Alarm, RTC_AlarmStruct))
+PROF_DRV_R(ErrorStatus, RTC_AlarmCmd, (uint32_t RTC_Alarm, FunctionalState NewState), (RTC_Alarm, NewState))
+PROF_DRV_V(RTC_AlarmSubSecondConfig, (uint32_t RTC_Alarm, uint32_t RTC_AlarmSubSecondValue, uint32_t RTC_AlarmSubSecondMask), (RTC_Alarm, RTC_AlarmSubSecondValue, RTC_AlarmSubSecondMask))
+PROF_DRV_R(uint32_t, RTC_GetAlarmSubSecond, (uint32_t RTC_Alarm), (RTC_Alarm))
+PROF_DRV_V(RTC_WakeUpClockConfig, (uint32_t RTC_WakeUpClock), (RTC_WakeUpClock))
+PROF_DRV_V(RTC_SetWakeUpCounter, (uint32_t RTC_WakeUpCounter), (RTC_WakeUpCounter))
+PROF_DRV_R(uint32_t, RTC_GetWakeUpCounter, (void), ())
+PROF_DRV_R(ErrorStatus, RTC_WakeUpCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(RTC_DayLightSavingConfig, (uint32_t RTC_DayLightSaving, uint32_t RTC_StoreOperation), (RTC_DayLightSaving, RTC_StoreOperation))
+PROF_DRV_R(uint32_t, RTC_GetStoreOperation, (void), ())
+PROF_DRV_V(RTC_OutputConfig, (uint32_t RTC_Output, uint32_t RTC_OutputPolarity), (RTC_Output, RTC_OutputPolarity))
+PROF_DRV_V(RTC_CalibOutputCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(RTC_CalibOutputConfig, (uint32_t RTC_CalibOutput), (RTC_CalibOutput))
+PROF_DRV_R(ErrorStatus, RTC_SmoothCalibConfig, (uint32_t RTC_SmoothCalibPeriod, uint32_t RTC_SmoothCalibPlusPulses, uint32_t RTC_SmouthCalibMinusPulsesValue), (RTC_SmoothCalibPeriod, RTC_SmoothCalibPlusPulses, RTC_SmouthCalibMinusPulsesValue))
+PROF_DRV_V(RTC_TimeStampCmd, (uint32_t RTC_TimeStampEdge, FunctionalState NewState), (RTC_TimeStampEdge, NewState))
+PROF_DRV_V(RTC_GetTimeStamp, (uint32_t RTC_Format, RTC_TimeTypeDef* RTC_StampTimeStruct, RTC_DateTypeDef* RTC_StampDateStruct), (RTC_Format, RTC_StampTimeStruct, RTC_StampDateStruct))
+PROF_DRV_R(uint32_t, RTC_GetTimeStampSubSecond, (void), ())
+PROF_DRV_V(RTC_TamperTriggerConfig, (uint32_t RTC_Tamper, uint32_t RTC_TamperTrigger), (RTC_Tamper, RTC_TamperTrigger))
+PROF_DRV_V(RTC_TamperCmd, (uint32_t RTC_Tamper, FunctionalState NewState), (RTC_Tamper, NewState))
+PROF_DRV_V(RTC_TamperFilterConfig, (uint32_t RTC_TamperFilter), (RTC_TamperFilter))
+PROF_DRV_V(RTC_TamperSamplingFreqConfig, (uint32_t RTC_TamperSamplingFreq), (RTC_TamperSamplingFreq))
+PROF_DRV_V(RTC_TamperPinsPrechargeDuration, (uint32_t RTC_TamperPrechargeDuration), (RTC_TamperPrechargeDuration))
+PROF_DRV_V(RTC_TimeStampOnTamperDetectionCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(RTC_TamperPullUpCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(RTC_WriteBackupRegister, (uint32_t RTC_BKP_DR, uint32_t Data), (RTC_BKP_DR, Data))
+PROF_DRV_R(uint32_t, RTC_ReadBackupRegister, (uint32_t RTC_BKP_DR), (RTC_BKP_DR))
+PROF_DRV_V(RTC_OutputTypeConfig, (uint32_t RTC_OutputType), (RTC_OutputType))
+PROF_DRV_R(ErrorStatus, RTC_SynchroShiftConfig, (uint32_t RTC_ShiftAdd1S, uint32_t RTC_ShiftSubFS), (RTC_ShiftAdd1S, RTC_ShiftSubFS))
+PROF_DRV_V(RTC_ITConfig, (uint32_t RTC_IT, FunctionalState NewState), (RTC_IT, NewState))
+PROF_DRV_R(FlagStatus, RTC_GetFlagStatus, (uint32_t RTC_FLAG), (RTC_FLAG))
+PROF_DRV_V(RTC_ClearFlag, (uint32_t RTC_FLAG), (RTC_FLAG))
+PROF_DRV_R(ITStatus, RTC_GetITStatus, (uint32_t RTC_IT), (RTC_IT))
+PROF_DRV_V(RTC_ClearITPendingBit, (uint32_t RTC_IT), (RTC_IT))
+#endif
+
+#ifdef __STM32F30x_SPI_H // stm32f30x_spi.h
+PROF_DRV_V(SPI_I2S_DeInit, (SPI_TypeDef* SPIx), (SPIx))
+PROF_DRV_V(SPI_Init, (SPI_TypeDef* SPIx, SPI_InitTypeDef* SPI_InitStruct), (SPIx, SPI_InitStruct))
+PROF_DRV_V(I2S_Init, (SPI_TypeDef* SPIx, I2S_InitTypeDef* I2S_InitStruct), (SPIx, I2S_InitStruct))
+PROF_DRV_V(SPI_StructInit, (SPI_InitTypeDef* SPI_InitStruct), (SPI_InitStruct))
+PROF_DRV_V(I2S_StructInit, (I2S_InitTypeDef* I2S_InitStruct), (I2S_InitStruct))
+PROF_DRV_V(SPI_TIModeCmd, (SPI_TypeDef* SPIx, FunctionalState NewState), (SPIx, NewState))
+PROF_DRV_V(SPI_NSSPulseModeCmd, (SPI_TypeDef* SPIx, FunctionalState NewState), (SPIx, NewState))
+PROF_DRV_V(SPI_Cmd, (SPI_TypeDef* SPIx, FunctionalState NewState), (SPIx, NewState))
+PROF_DRV_V(I2S_Cmd, (SPI_TypeDef* SPIx, FunctionalState NewState), (SPIx, NewState))
+PROF_DRV_V(SPI_DataSizeConfig, (SPI_TypeDef* SPIx, uint16_t SPI_DataSize), (SPIx, SPI_DataSize))
+PROF_DRV_V(SPI_RxFIFOThresholdConfig, (SPI_TypeDef* SPIx, uint16_t SPI_RxFIFOThreshold), (SPIx, SPI_RxFIFOThreshold))
+PROF_DRV_V(SPI_BiDirectionalLineConfig, (SPI_TypeDef* SPIx, uint16_t SPI_Direction), (SPIx, SPI_Direction))
+PROF_DRV_V(SPI_NSSInternalSoftwareConfig, (SPI_TypeDef* SPIx, uint16_t SPI_NSSInternalSoft), (SPIx, SPI_NSSInternalSoft))
+PROF_DRV_V(SPI_SSOutputCmd, (SPI_TypeDef* SPIx, FunctionalState NewState), (SPIx, NewState))
+PROF_DRV_V(I2S_FullDuplexConfig, (SPI_TypeDef* I2Sxext, I2S_InitTypeDef* I2S_InitStruct), (I2Sxext, I2S_InitStruct))
+PROF_DRV_V(SPI_SendData8, (SPI_TypeDef* SPIx, uint8_t Data), (SPIx, Data))
+PROF_DRV_V(SPI_I2S_SendData16, (SPI_TypeDef* SPIx, uint16_t Data), (SPIx, Data))
+PROF_DRV_R(uint8_t, SPI_ReceiveData8, (SPI_TypeDef* SPIx), (SPIx))
+PROF_DRV_R(uint16_t, SPI_I2S_ReceiveData16, (SPI_TypeDef* SPIx), (SPIx))
+PROF_DRV_V(SPI_CRCLengthConfig, (SPI_TypeDef* SPIx, uint16_t SPI_CRCLength), (SPIx, SPI_CRCLength))
+PROF_DRV_V(SPI_CalculateCRC, (SPI_TypeDef* SPIx, FunctionalState NewState), (SPIx, NewState))
+PROF_DRV_V(SPI_TransmitCRC, (SPI_TypeDef* SPIx), (SPIx))
+PROF_DRV_R(uint16_t, SPI_GetCRC, (SPI_TypeDef* SPIx, uint8_t SPI_CRC), (SPIx, SPI_CRC))
+PROF_DRV_R(uint16_t, SPI_GetCRCPolynomial, (SPI_TypeDef* SPIx), (SPIx))
+PROF_DRV_V(SPI_I2S_DMACmd, (SPI_TypeDef* SPIx, uint16_t SPI_I2S_DMAReq, FunctionalState NewState), (SPIx, SPI_I2S_DMAReq, NewState))
+PROF_DRV_V(SPI_LastDMATransferCmd, (SPI_TypeDef* SPIx, uint16_t SPI_LastDMATransfer), (SPIx, SPI_LastDMATransfer))
+PROF_DRV_V(SPI_I2S_ITConfig, (SPI_TypeDef* SPIx, uint8_t SPI_I2S_IT, FunctionalState NewState), (SPIx, SPI_I2S_IT, NewState))
+PROF_DRV_R(uint16_t, SPI_GetTransmissionFIFOStatus, (SPI_TypeDef* SPIx), (SPIx))
+PROF_DRV_R(uint16_t, SPI_GetReceptionFIFOStatus, (SPI_TypeDef* SPIx), (SPIx))
+PROF_DRV_R(FlagStatus, SPI_I2S_GetFlagStatus, (SPI_TypeDef* SPIx, uint16_t SPI_I2S_FLAG), (SPIx, SPI_I2S_FLAG))
+PROF_DRV_V(SPI_I2S_ClearFlag, (SPI_TypeDef* SPIx, uint16_t SPI_I2S_FLAG), (SPIx, SPI_I2S_FLAG))
+PROF_DRV_R(ITStatus, SPI_I2S_GetITStatus, (SPI_TypeDef* SPIx, uint8_t SPI_I2S_IT), (SPIx, SPI_I2S_IT))
+#endif
+
+#ifdef __STM32F30x_SYSCFG_H // stm32f30x_syscfg.h
+PROF_DRV_V(SYSCFG_DeInit, (void), ())
+PROF_DRV_V(SYSCFG_MemoryRemapConfig, (uint32_t SYSCFG_MemoryRemap), (SYSCFG_MemoryRemap))
+PROF_DRV_V(SYSCFG_DMAChannelRemapConfig, (uint32_t SYSCFG_DMARemap, FunctionalState NewState), (SYSCFG_DMARemap, NewState))
+PROF_DRV_V(SYSCFG_TriggerRemapConfig, (uint32_t SYSCFG_TriggerRemap, FunctionalState NewState), (SYSCFG_TriggerRemap, NewState))
+PROF_DRV_V(SYSCFG_EncoderRemapConfig, (uint32_t SYSCFG_EncoderRemap), (SYSCFG_EncoderRemap))
+PROF_DRV_V(SYSCFG_USBInterruptLineRemapCmd, (FunctionalState NewState), (NewState))
+PROF_DRV_V(SYSCFG_I2CFastModePlusConfig, (uint32_t SYSCFG_I2CFastModePlus, FunctionalState NewState), (SYSCFG_I2CFastModePlus, NewState))
+PROF_DRV_V(SYSCFG_ITConfig, (uint32_t SYSCFG_IT, FunctionalState NewState), (SYSCFG_IT, NewState))
+PROF_DRV_V(SYSCFG_EXTILineConfig, (uint8_t EXTI_PortSourceGPIOx, uint8_t EXTI_PinSourcex), (EXTI_PortSourceGPIOx, EXTI_PinSourcex))
+PROF_DRV_V(SYSCFG_BreakConfig, (uint32_t SYSCFG_Break), (SYSCFG_Break))
+PROF_DRV_V(SYSCFG_BypassParityCheckDisable, (void), ())
+PROF_DRV_V(SYSCFG_ADCTriggerRemapConfig, (uint32_t SYSCFG_ADCTriggerRemap, FunctionalState NewState), (SYSCFG_ADCTriggerRemap, NewState))
+PROF_DRV_V(SYSCFG_SRAMWRPEnable, (uint32_t SYSCFG_SRAMWRP), (SYSCFG_SRAMWRP))
+PROF_DRV_R(FlagStatus, SYSCFG_GetFlagStatus, (uint32_t SYSCFG_Flag), (SYSCFG_Flag))
+PROF_DRV_V(SYSCFG_ClearFlag, (uint32_t SYSCFG_Flag), (SYSCFG_Flag))
+#endif
+
+#ifdef __STM32F30x_TIM_H // stm32f30x_tim.h
+PROF_DRV_V(TIM_DeInit, (TIM_TypeDef* TIMx), (TIMx))
+PROF_DRV_V(TIM_TimeBaseInit, (TIM_TypeDef* TIMx, TIM_TimeBaseInitTypeDef* TIM_TimeBaseInitStruct), (TIMx, TIM_TimeBaseInitStruct))
+PROF_DRV_V(TIM_TimeBaseStructInit, (TIM_TimeBaseInitTypeDef* TIM_TimeBaseInitStruct), (TIM_TimeBaseInitStruct))
+PROF_DRV_V(TIM_PrescalerConfig, (TIM_TypeDef* TIMx, uint16_t Prescaler, uint16_t TIM_PSCReloadMode), (TIMx, Prescaler, TIM_PSCReloadMode))
+PROF_DRV_V(TIM_CounterModeConfig, (TIM_TypeDef* TIMx, uint16_t TIM_CounterMode), (TIMx, TIM_CounterMode))
+PROF_DRV_V(TIM_SetCounter, (TIM_TypeDef* TIMx, uint32_t Counter), (TIMx, Counter))
+PROF_DRV_V(TIM_SetAutoreload, (TIM_TypeDef* TIMx, uint32_t Autoreload), (TIMx, Autoreload))
+PROF_DRV_R(uint32_t, TIM_GetCounter, (TIM_TypeDef* TIMx), (TIMx))
+PROF_DRV_R(uint16_t, TIM_GetPrescaler, (TIM_TypeDef* TIMx), (TIMx))
+PROF_DRV_V(TIM_UpdateDisableConfig, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_UpdateRequestConfig, (TIM_TypeDef* TIMx, uint16_t TIM_UpdateSource), (TIMx, TIM_UpdateSource))
+PROF_DRV_V(TIM_UIFRemap, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_ARRPreloadConfig, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_SelectOnePulseMode, (TIM_TypeDef* TIMx, uint16_t TIM_OPMode), (TIMx, TIM_OPMode))
+PROF_DRV_V(TIM_SetClockDivision, (TIM_TypeDef* TIMx, uint16_t TIM_CKD), (TIMx, TIM_CKD))
+PROF_DRV_V(TIM_Cmd, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_OC1Init, (TIM_TypeDef* TIMx, TIM_OCInitTypeDef* TIM_OCInitStruct), (TIMx, TIM_OCInitStruct))
+PROF_DRV_V(TIM_OC2Init, (TIM_TypeDef* TIMx, TIM_OCInitTypeDef* TIM_OCInitStruct), (TIMx, TIM_OCInitStruct))
+PROF_DRV_V(TIM_OC3Init, (TIM_TypeDef* TIMx, TIM_OCInitTypeDef* TIM_OCInitStruct), (TIMx, TIM_OCInitStruct))
+PROF_DRV_V(TIM_OC4Init, (TIM_TypeDef* TIMx, TIM_OCInitTypeDef* TIM_OCInitStruct), (TIMx, TIM_OCInitStruct))
+PROF_DRV_V(TIM_OC5Init, (TIM_TypeDef* TIMx, TIM_OCInitTypeDef* TIM_OCInitStruct), (TIMx, TIM_OCInitStruct))
+PROF_DRV_V(TIM_OC6Init, (TIM_TypeDef* TIMx, TIM_OCInitTypeDef* TIM_OCInitStruct), (TIMx, TIM_OCInitStruct))
+PROF_DRV_V(TIM_SelectGC5C1, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_SelectGC5C2, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_SelectGC5C3, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_OCStructInit, (TIM_OCInitTypeDef* TIM_OCInitStruct), (TIM_OCInitStruct))
+PROF_DRV_V(TIM_SelectOCxM, (TIM_TypeDef* TIMx, uint16_t TIM_Channel, uint32_t TIM_OCMode), (TIMx, TIM_Channel, TIM_OCMode))
+PROF_DRV_V(TIM_SetCompare1, (TIM_TypeDef* TIMx, uint32_t Compare1), (TIMx, Compare1))
+PROF_DRV_V(TIM_SetCompare2, (TIM_TypeDef* TIMx, uint32_t Compare2), (TIMx, Compare2))
+PROF_DRV_V(TIM_SetCompare3, (TIM_TypeDef* TIMx, uint32_t Compare3), (TIMx, Compare3))
+PROF_DRV_V(TIM_SetCompare4, (TIM_TypeDef* TIMx, uint32_t Compare4), (TIMx, Compare4))
+PROF_DRV_V(TIM_SetCompare5, (TIM_TypeDef* TIMx, uint32_t Compare5), (TIMx, Compare5))
+PROF_DRV_V(TIM_SetCompare6, (TIM_TypeDef* TIMx, uint32_t Compare6), (TIMx, Compare6))
+PROF_DRV_V(TIM_ForcedOC1Config, (TIM_TypeDef* TIMx, uint16_t TIM_ForcedAction), (TIMx, TIM_ForcedAction))
+PROF_DRV_V(TIM_ForcedOC2Config, (TIM_TypeDef* TIMx, uint16_t TIM_ForcedAction), (TIMx, TIM_ForcedAction))
+PROF_DRV_V(TIM_ForcedOC3Config, (TIM_TypeDef* TIMx, uint16_t TIM_ForcedAction), (TIMx, TIM_ForcedAction))
+PROF_DRV_V(TIM_ForcedOC4Config, (TIM_TypeDef* TIMx, uint16_t TIM_ForcedAction), (TIMx, TIM_ForcedAction))
+PROF_DRV_V(TIM_ForcedOC5Config, (TIM_TypeDef* TIMx, uint16_t TIM_ForcedAction), (TIMx, TIM_ForcedAction))
+PROF_DRV_V(TIM_ForcedOC6Config, (TIM_TypeDef* TIMx, uint16_t TIM_ForcedAction), (TIMx, TIM_ForcedAction))
+PROF_DRV_V(TIM_OC1PreloadConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCPreload), (TIMx, TIM_OCPreload))
+PROF_DRV_V(TIM_OC2PreloadConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCPreload), (TIMx, TIM_OCPreload))
+PROF_DRV_V(TIM_OC3PreloadConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCPreload), (TIMx, TIM_OCPreload))
+PROF_DRV_V(TIM_OC4PreloadConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCPreload), (TIMx, TIM_OCPreload))
+PROF_DRV_V(TIM_OC5PreloadConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCPreload), (TIMx, TIM_OCPreload))
+PROF_DRV_V(TIM_OC6PreloadConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCPreload), (TIMx, TIM_OCPreload))
+PROF_DRV_V(TIM_OC1FastConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCFast), (TIMx, TIM_OCFast))
+PROF_DRV_V(TIM_OC2FastConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCFast), (TIMx, TIM_OCFast))
+PROF_DRV_V(TIM_OC3FastConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCFast), (TIMx, TIM_OCFast))
+PROF_DRV_V(TIM_OC4FastConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCFast), (TIMx, TIM_OCFast))
+PROF_DRV_V(TIM_ClearOC1Ref, (TIM_TypeDef* TIMx, uint16_t TIM_OCClear), (TIMx, TIM_OCClear))
+PROF_DRV_V(TIM_ClearOC2Ref, (TIM_TypeDef* TIMx, uint16_t TIM_OCClear), (TIMx, TIM_OCClear))
+PROF_DRV_V(TIM_ClearOC3Ref, (TIM_TypeDef* TIMx, uint16_t TIM_OCClear), (TIMx, TIM_OCClear))
+PROF_DRV_V(TIM_ClearOC4Ref, (TIM_TypeDef* TIMx, uint16_t TIM_OCClear), (TIMx, TIM_OCClear))
+PROF_DRV_V(TIM_ClearOC5Ref, (TIM_TypeDef* TIMx, uint16_t TIM_OCClear), (TIMx, TIM_OCClear))
+PROF_DRV_V(TIM_ClearOC6Ref, (TIM_TypeDef* TIMx, uint16_t TIM_OCClear), (TIMx, TIM_OCClear))
+PROF_DRV_V(TIM_SelectOCREFClear, (TIM_TypeDef* TIMx, uint16_t TIM_OCReferenceClear), (TIMx, TIM_OCReferenceClear))
+PROF_DRV_V(TIM_OC1PolarityConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCPolarity), (TIMx, TIM_OCPolarity))
+PROF_DRV_V(TIM_OC1NPolarityConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCNPolarity), (TIMx, TIM_OCNPolarity))
+PROF_DRV_V(TIM_OC2PolarityConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCPolarity), (TIMx, TIM_OCPolarity))
+PROF_DRV_V(TIM_OC2NPolarityConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCNPolarity), (TIMx, TIM_OCNPolarity))
+PROF_DRV_V(TIM_OC3PolarityConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCPolarity), (TIMx, TIM_OCPolarity))
+PROF_DRV_V(TIM_OC3NPolarityConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCNPolarity), (TIMx, TIM_OCNPolarity))
+PROF_DRV_V(TIM_OC4PolarityConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCPolarity), (TIMx, TIM_OCPolarity))
+PROF_DRV_V(TIM_OC5PolarityConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCPolarity), (TIMx, TIM_OCPolarity))
+PROF_DRV_V(TIM_OC6PolarityConfig, (TIM_TypeDef* TIMx, uint16_t TIM_OCPolarity), (TIMx, TIM_OCPolarity))
+PROF_DRV_V(TIM_CCxCmd, (TIM_TypeDef* TIMx, uint16_t TIM_Channel, uint16_t TIM_CCx), (TIMx, TIM_Channel, TIM_CCx))
+PROF_DRV_V(TIM_CCxNCmd, (TIM_TypeDef* TIMx, uint16_t TIM_Channel, uint16_t TIM_CCxN), (TIMx, TIM_Channel, TIM_CCxN))
+PROF_DRV_V(TIM_ICInit, (TIM_TypeDef* TIMx, TIM_ICInitTypeDef* TIM_ICInitStruct), (TIMx, TIM_ICInitStruct))
+PROF_DRV_V(TIM_ICStructInit, (TIM_ICInitTypeDef* TIM_ICInitStruct), (TIM_ICInitStruct))
+PROF_DRV_V(TIM_PWMIConfig, (TIM_TypeDef* TIMx, TIM_ICInitTypeDef* TIM_ICInitStruct), (TIMx, TIM_ICInitStruct))
+PROF_DRV_R(uint32_t, TIM_GetCapture1, (TIM_TypeDef* TIMx), (TIMx))
+PROF_DRV_R(uint32_t, TIM_GetCapture2, (TIM_TypeDef* TIMx), (TIMx))
+PROF_DRV_R(uint32_t, TIM_GetCapture3, (TIM_TypeDef* TIMx), (TIMx))
+PROF_DRV_R(uint32_t, TIM_GetCapture4, (TIM_TypeDef* TIMx), (TIMx))
+PROF_DRV_V(TIM_SetIC1Prescaler, (TIM_TypeDef* TIMx, uint16_t TIM_ICPSC), (TIMx, TIM_ICPSC))
+PROF_DRV_V(TIM_SetIC2Prescaler, (TIM_TypeDef* TIMx, uint16_t TIM_ICPSC), (TIMx, TIM_ICPSC))
+PROF_DRV_V(TIM_SetIC3Prescaler, (TIM_TypeDef* TIMx, uint16_t TIM_ICPSC), (TIMx, TIM_ICPSC))
+PROF_DRV_V(TIM_SetIC4Prescaler, (TIM_TypeDef* TIMx, uint16_t TIM_ICPSC), (TIMx, TIM_ICPSC))
+PROF_DRV_V(TIM_BDTRConfig, (TIM_TypeDef* TIMx, TIM_BDTRInitTypeDef *TIM_BDTRInitStruct), (TIMx, TIM_BDTRInitStruct))
+PROF_DRV_V(TIM_Break1Config, (TIM_TypeDef* TIMx, uint32_t TIM_Break1Polarity, uint8_t TIM_Break1Filter), (TIMx, TIM_Break1Polarity, TIM_Break1Filter))
+PROF_DRV_V(TIM_Break2Config, (TIM_TypeDef* TIMx, uint32_t TIM_Break2Polarity, uint8_t TIM_Break2Filter), (TIMx, TIM_Break2Polarity, TIM_Break2Filter))
+PROF_DRV_V(TIM_Break1Cmd, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_Break2Cmd, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_BDTRStructInit, (TIM_BDTRInitTypeDef* TIM_BDTRInitStruct), (TIM_BDTRInitStruct))
+PROF_DRV_V(TIM_CtrlPWMOutputs, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_SelectCOM, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_CCPreloadControl, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_ITConfig, (TIM_TypeDef* TIMx, uint16_t TIM_IT, FunctionalState NewState), (TIMx, TIM_IT, NewState))
+PROF_DRV_V(TIM_GenerateEvent, (TIM_TypeDef* TIMx, uint16_t TIM_EventSource), (TIMx, TIM_EventSource))
+PROF_DRV_R(FlagStatus, TIM_GetFlagStatus, (TIM_TypeDef* TIMx, uint32_t TIM_FLAG), (TIMx, TIM_FLAG))
+PROF_DRV_V(TIM_ClearFlag, (TIM_TypeDef* TIMx, uint16_t TIM_FLAG), (TIMx, TIM_FLAG))
+PROF_DRV_R(ITStatus, TIM_GetITStatus, (TIM_TypeDef* TIMx, uint16_t TIM_IT), (TIMx, TIM_IT))
+PROF_DRV_V(TIM_ClearITPendingBit, (TIM_TypeDef* TIMx, uint16_t TIM_IT), (TIMx, TIM_IT))
+PROF_DRV_V(TIM_DMAConfig, (TIM_TypeDef* TIMx, uint16_t TIM_DMABase, uint16_t TIM_DMABurstLength), (TIMx, TIM_DMABase, TIM_DMABurstLength))
+PROF_DRV_V(TIM_DMACmd, (TIM_TypeDef* TIMx, uint16_t TIM_DMASource, FunctionalState NewState), (TIMx, TIM_DMASource, NewState))
+PROF_DRV_V(TIM_SelectCCDMA, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_InternalClockConfig, (TIM_TypeDef* TIMx), (TIMx))
+PROF_DRV_V(TIM_ITRxExternalClockConfig, (TIM_TypeDef* TIMx, uint16_t TIM_InputTriggerSource), (TIMx, TIM_InputTriggerSource))
+PROF_DRV_V(TIM_TIxExternalClockConfig, (TIM_TypeDef* TIMx, uint16_t TIM_TIxExternalCLKSource, uint16_t TIM_ICPolarity, uint16_t ICFilter), (TIMx, TIM_TIxExternalCLKSource, TIM_ICPolarity, ICFilter))
+PROF_DRV_V(TIM_ETRClockMode1Config, (TIM_TypeDef* TIMx, uint16_t TIM_ExtTRGPrescaler, uint16_t TIM_ExtTRGPolarity, uint16_t ExtTRGFilter), (TIMx, TIM_ExtTRGPrescaler, TIM_ExtTRGPolarity, ExtTRGFilter))
+PROF_DRV_V(TIM_ETRClockMode2Config, (TIM_TypeDef* TIMx, uint16_t TIM_ExtTRGPrescaler, uint16_t TIM_ExtTRGPolarity, uint16_t ExtTRGFilter), (TIMx, TIM_ExtTRGPrescaler, TIM_ExtTRGPolarity, ExtTRGFilter))
+PROF_DRV_V(TIM_SelectInputTrigger, (TIM_TypeDef* TIMx, uint16_t TIM_InputTriggerSource), (TIMx, TIM_InputTriggerSource))
+PROF_DRV_V(TIM_SelectOutputTrigger, (TIM_TypeDef* TIMx, uint16_t TIM_TRGOSource), (TIMx, TIM_TRGOSource))
+PROF_DRV_V(TIM_SelectOutputTrigger2, (TIM_TypeDef* TIMx, uint32_t TIM_TRGO2Source), (TIMx, TIM_TRGO2Source))
+PROF_DRV_V(TIM_SelectSlaveMode, (TIM_TypeDef* TIMx, uint32_t TIM_SlaveMode), (TIMx, TIM_SlaveMode))
+PROF_DRV_V(TIM_SelectMasterSlaveMode, (TIM_TypeDef* TIMx, uint16_t TIM_MasterSlaveMode), (TIMx, TIM_MasterSlaveMode))
+PROF_DRV_V(TIM_ETRConfig, (TIM_TypeDef* TIMx, uint16_t TIM_ExtTRGPrescaler, uint16_t TIM_ExtTRGPolarity, uint16_t ExtTRGFilter), (TIMx, TIM_ExtTRGPrescaler, TIM_ExtTRGPolarity, ExtTRGFilter))
+PROF_DRV_V(TIM_EncoderInterfaceConfig, (TIM_TypeDef* TIMx, uint16_t TIM_EncoderMode, uint16_t TIM_IC1Polarity, uint16_t TIM_IC2Polarity), (TIMx, TIM_EncoderMode, TIM_IC1Polarity, TIM_IC2Polarity))
+PROF_DRV_V(TIM_SelectHallSensor, (TIM_TypeDef* TIMx, FunctionalState NewState), (TIMx, NewState))
+PROF_DRV_V(TIM_RemapConfig, (TIM_TypeDef* TIMx, uint16_t TIM_Remap), (TIMx, TIM_Remap))
+#endif
+
+#ifdef __STM32F30x_USART_H // stm32f30x_usart.h
+PROF_DRV_V(USART_DeInit, (USART_TypeDef* USARTx), (USARTx))
+PROF_DRV_V(USART_Init, (USART_TypeDef* USARTx, USART_InitTypeDef* USART_InitStruct), (USARTx, USART_InitStruct))
+PROF_DRV_V(USART_StructInit, (USART_InitTypeDef* USART_InitStruct), (USART_InitStruct))
+PROF_DRV_V(USART_ClockInit, (USART_TypeDef* USARTx, USART_ClockInitTypeDef* USART_ClockInitStruct), (USARTx, USART_ClockInitStruct))
+PROF_DRV_V(USART_ClockStructInit, (USART_ClockInitTypeDef* USART_ClockInitStruct), (USART_ClockInitStruct))
+PROF_DRV_V(USART_Cmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_DirectionModeCmd, (USART_TypeDef* USARTx, uint32_t USART_DirectionMode, FunctionalState NewState), (USARTx, USART_DirectionMode, NewState))
+PROF_DRV_V(USART_SetPrescaler, (USART_TypeDef* USARTx, uint8_t USART_Prescaler), (USARTx, USART_Prescaler))
+PROF_DRV_V(USART_OverSampling8Cmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_OneBitMethodCmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_MSBFirstCmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_DataInvCmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_InvPinCmd, (USART_TypeDef* USARTx, uint32_t USART_InvPin, FunctionalState NewState), (USARTx, USART_InvPin, NewState))
+PROF_DRV_V(USART_SWAPPinCmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_ReceiverTimeOutCmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_SetReceiverTimeOut, (USART_TypeDef* USARTx, uint32_t USART_ReceiverTimeOut), (USARTx, USART_ReceiverTimeOut))
+PROF_DRV_V(USART_STOPModeCmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_StopModeWakeUpSourceConfig, (USART_TypeDef* USARTx, uint32_t USART_WakeUpSource), (USARTx, USART_WakeUpSource))
+PROF_DRV_V(USART_AutoBaudRateCmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_AutoBaudRateConfig, (USART_TypeDef* USARTx, uint32_t USART_AutoBaudRate), (USARTx, USART_AutoBaudRate))
+PROF_DRV_V(USART_SendData, (USART_TypeDef* USARTx, uint16_t Data), (USARTx, Data))
+PROF_DRV_R(uint16_t, USART_ReceiveData, (USART_TypeDef* USARTx), (USARTx))
+PROF_DRV_V(USART_SetAddress, (USART_TypeDef* USARTx, uint8_t USART_Address), (USARTx, USART_Address))
+PROF_DRV_V(USART_MuteModeWakeUpConfig, (USART_TypeDef* USARTx, uint32_t USART_WakeUp), (USARTx, USART_WakeUp))
+PROF_DRV_V(USART_MuteModeCmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_AddressDetectionConfig, (USART_TypeDef* USARTx, uint32_t USART_AddressLength), (USARTx, USART_AddressLength))
+PROF_DRV_V(USART_LINBreakDetectLengthConfig, (USART_TypeDef* USARTx, uint32_t USART_LINBreakDetectLength), (USARTx, USART_LINBreakDetectLength))
+PROF_DRV_V(USART_LINCmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_HalfDuplexCmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_SmartCardCmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_SmartCardNACKCmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_SetGuardTime, (USART_TypeDef* USARTx, uint8_t USART_GuardTime), (USARTx, USART_GuardTime))
+PROF_DRV_V(USART_SetAutoRetryCount, (USART_TypeDef* USARTx, uint8_t USART_AutoCount), (USARTx, USART_AutoCount))
+PROF_DRV_V(USART_SetBlockLength, (USART_TypeDef* USARTx, uint8_t USART_BlockLength), (USARTx, USART_BlockLength))
+PROF_DRV_V(USART_IrDAConfig, (USART_TypeDef* USARTx, uint32_t USART_IrDAMode), (USARTx, USART_IrDAMode))
+PROF_DRV_V(USART_IrDACmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_DECmd, (USART_TypeDef* USARTx, FunctionalState NewState), (USARTx, NewState))
+PROF_DRV_V(USART_DEPolarityConfig, (USART_TypeDef* USARTx, uint32_t USART_DEPolarity), (USARTx, USART_DEPolarity))
+PROF_DRV_V(USART_SetDEAssertionTime, (USART_TypeDef* USARTx, uint32_t USART_DEAssertionTime), (USARTx, USART_DEAssertionTime))
+PROF_DRV_V(USART_SetDEDeassertionTime, (USART_TypeDef* USARTx, uint32_t USART_DEDeassertionTime), (USARTx, USART_DEDeassertionTime))
+PROF_DRV_V(USART_DMACmd, (USART_TypeDef* USARTx, uint32_t USART_DMAReq, FunctionalState NewState), (USARTx, USART_DMAReq, NewState))
+PROF_DRV_V(USART_DMAReceptionErrorConfig, (USART_TypeDef* USARTx, uint32_t USART_DMAOnError), (USARTx, USART_DMAOnError))
+PROF_DRV_V(USART_ITConfig, (USART_TypeDef* USARTx, uint32_t USART_IT, FunctionalState NewState), (USARTx, USART_IT, NewState))
+PROF_DRV_V(USART_RequestCmd, (USART_TypeDef* USARTx, uint32_t USART_Request, FunctionalState NewState), (USARTx, USART_Request, NewState))
+PROF_DRV_V(USART_OverrunDetectionConfig, (USART_TypeDef* USARTx, uint32_t USART_OVRDetection), (USARTx, USART_OVRDetection))
+PROF_DRV_R(FlagStatus, USART_GetFlagStatus, (USART_TypeDef* USARTx, uint32_t USART_FLAG), (USARTx, USART_FLAG))
+PROF_DRV_V(USART_ClearFlag, (USART_TypeDef* USARTx, uint32_t USART_FLAG), (USARTx, USART_FLAG))
+PROF_DRV_R(ITStatus, USART_GetITStatus, (USART_TypeDef* USARTx, uint32_t USART_IT), (USARTx, USART_IT))
+PROF_DRV_V(USART_ClearITPendingBit, (USART_TypeDef* USARTx, uint32_t USART_IT), (USARTx, USART_IT))
+#endif
+
+#ifdef __STM32F30x_WWDG_H // stm32f30x_wwdg.h
+PROF_DRV_V(WWDG_DeInit, (void), ())
+PROF_DRV_V(WWDG_SetPrescaler, (uint32_t WWDG_Prescaler), (WWDG_Prescaler))
+PROF_DRV_V(WWDG_SetWindowValue, (uint8_t WindowValue), (WindowValue))
+PROF_DRV_V(WWDG_EnableIT, (void), ())
+PROF_DRV_V(WWDG_SetCounter, (uint8_t Counter), (Counter))
+PROF_DRV_V(WWDG_Enable, (uint8_t Counter), (Counter))
+PROF_DRV_R(FlagStatus, WWDG_GetFlagStatus, (void), ())
+PROF_DRV_V(WWDG_ClearFlag, (void), ())
+#endif
@@ -0,0 +1,364 @@
+/***********************************************************************
+ File Name    : 'profiling_dsp_bench.c'
+ Title        : PROFILER
+ Description  : CMSIS-DSP kernel benchmark suite.
+                Every kernel is timed by PROF_BENCH_Measure() for each
+                block size and data type, result is printed as BENCH CSV
+                (Tools/bench_compare.py) and as cycles per sample table.
+                Sample is input sample for filters, point for FFT and
+                output element for N x N matrix multiplication.
+                Buffers are not restored between iterations, Cortex-M4
+                MAC and FPU timing does not depend on data.
+
+                Examle output:
+                DSP kernels at 72000000 Hz, cycles/sample:
+                --Kernel----------------|-----N-|------f32-|------q31-|------q15-
+                fir32                   |    64 |    38.52 |    42.16 |    31.08
+                fir32_fast              |    64 |        - |    26.11 |    20.63
+                cfft                    |   256 |    21.30 |    27.84 |    15.92
+                mat_mult                |     8 |    47.06 |    65.31 |    44.20
+
+ Target MCU   : STM32F30x
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_dsp_bench.h"
+
+#if PROFILING_DSP_BENCH && PROFILING_BENCH
+
+#ifndef ARM_MATH_CM4
+#define ARM_MATH_CM4
+#endif
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+#define DSP_MAX_N    256  // largest block size, FFT length, matrix elements
+#define DSP_TAPS     32   // FIR taps, even for q15
+#define DSP_STAGES   4    // biquad stages
+#define DSP_SIZES    4    // block sizes per kernel
+#define DSP_TYPES    3
+
+enum { DSP_F32, DSP_Q31, DSP_Q15 };
+
+typedef union
+{
+  float32_t f32[2 * DSP_MAX_N];
+  q31_t     q31[2 * DSP_MAX_N];
+  q15_t     q15[2 * DSP_MAX_N];
+} dsp_buf_t;
+
+typedef struct
+{
+  const char    *name;
+  uint16_t      size[DSP_SIZES];              // 0 - unused
+  uint8_t       square;                       // 1 - size is N of N x N matrix
+  int           (*setup)(int type, uint16_t n); // 0 - size not supported
+  PROF_BENCH_Fn fn[DSP_TYPES];                // f32, q31, q15, NULL - no variant
+} dsp_kernel_t;
+
+/* Private function prototypes ---------------------------------------*/
+static void dsp_fill(int type);
+static int  setup_fir(int type, uint16_t n);
+static int  setup_biquad(int type, uint16_t n);
+static int  setup_df2T(int type, uint16_t n);
+static int  setup_cfft(int type, uint16_t n);
+static int  setup_rfft(int type, uint16_t n);
+static int  setup_mat(int type, uint16_t n);
+static void fir_f32(void *arg);
+static void fir_q31(void *arg);
+static void fir_q15(void *arg);
+static void fir_fast_q31(void *arg);
+static void fir_fast_q15(void *arg);
+static void biquad_f32(void *arg);
+static void biquad_q31(void *arg);
+static void biquad_q15(void *arg);
+static void biquad_fast_q31(void *arg);
+static void biquad_fast_q15(void *arg);
+static void df2T_f32(void *arg);
+static void cfft_f32(void *arg);
+static void cfft_q31(void *arg);
+static void cfft_q15(void *arg);
+static void rfft_f32(void *arg);
+static void rfft_q31(void *arg);
+static void rfft_q15(void *arg);
+static void mat_f32(void *arg);
+static void mat_q31(void *arg);
+static void mat_q15(void *arg);
+static void mat_fast_q31(void *arg);
+static void mat_fast_q15(void *arg);
+
+/* Private variables -------------------------------------------------*/
+static const char * const type_name[DSP_TYPES] = { "f32", "q31", "q15" };
+
+static const dsp_kernel_t kernel[] =
+{
+  { "fir32",            { 32, 64, 128, 256 }, 0, setup_fir,    { fir_f32, fir_q31, fir_q15 } },
+  { "fir32_fast",       { 32, 64, 128, 256 }, 0, setup_fir,    { NULL, fir_fast_q31, fir_fast_q15 } },
+  { "biquad4_df1",      { 32, 64, 128, 256 }, 0, setup_biquad, { biquad_f32, biquad_q31, biquad_q15 } },
+  { "biquad4_df1_fast", { 32, 64, 128, 256 }, 0, setup_biquad, { NULL, biquad_fast_q31, biquad_fast_q15 } },
+  { "biquad4_df2T",     { 32, 64, 128, 256 }, 0, setup_df2T,   { df2T_f32, NULL, NULL } },
+  { "cfft",             { 32, 64, 128, 256 }, 0, setup_cfft,   { cfft_f32, cfft_q31, cfft_q15 } },
+  { "rfft",             { 32, 64, 128, 256 }, 0, setup_rfft,   { rfft_f32, rfft_q31, rfft_q15 } },
+  { "mat_mult",         { 4, 8, 16 },         1, setup_mat,    { mat_f32, mat_q31, mat_q15 } },
+  { "mat_mult_fast",    { 4, 8, 16 },         1, setup_mat,    { NULL, mat_fast_q31, mat_fast_q15 } },
+};
+
+#define DSP_KERNELS  (int)(sizeof(kernel) / sizeof(kernel[0]))
+
+static dsp_buf_t in, out, state;
+static float32_t coef_f32[DSP_TAPS];
+static q31_t     coef_q31[DSP_TAPS];
+static q15_t     coef_q15[DSP_TAPS];
+static uint16_t  dsp_n;
+
+static arm_fir_instance_f32 fir_f32_s;
+static arm_fir_instance_q31 fir_q31_s;
+static arm_fir_instance_q15 fir_q15_s;
+static arm_biquad_casd_df1_inst_f32 biquad_f32_s;
+static arm_biquad_casd_df1_inst_q31 biquad_q31_s;
+static arm_biquad_casd_df1_inst_q15 biquad_q15_s;
+static arm_biquad_cascade_df2T_instance_f32 df2T_f32_s;
+static const arm_cfft_instance_f32 *cfft_f32_s;
+static const arm_cfft_instance_q31 *cfft_q31_s;
+static const arm_cfft_instance_q15 *cfft_q15_s;
+static arm_rfft_fast_instance_f32 rfft_f32_s;
+static arm_rfft_instance_q31 rfft_q31_s;
+static arm_rfft_instance_q15 rfft_q15_s;
+static arm_matrix_instance_f32 mat_f32_s[3];
+static arm_matrix_instance_q31 mat_q31_s[3];
+static arm_matrix_instance_q15 mat_q15_s[3];
+
+static const arm_cfft_instance_f32 * const cfft_f32_len[DSP_SIZES] =
+  { &arm_cfft_sR_f32_len32, &arm_cfft_sR_f32_len64, &arm_cfft_sR_f32_len128, &arm_cfft_sR_f32_len256 };
+static const arm_cfft_instance_q31 * const cfft_q31_len[DSP_SIZES] =
+  { &arm_cfft_sR_q31_len32, &arm_cfft_sR_q31_len64, &arm_cfft_sR_q31_len128, &arm_cfft_sR_q31_len256 };
+static const arm_cfft_instance_q15 * const cfft_q15_len[DSP_SIZES] =
+  { &arm_cfft_sR_q15_len32, &arm_cfft_sR_q15_len64, &arm_cfft_sR_q15_len128, &arm_cfft_sR_q15_len256 };
+
+// cycles/sample, < 0 - not measured
+static float result[DSP_KERNELS][DSP_SIZES][DSP_TYPES];
+/* -------------------------------------------------------------------*/
+
+
+static void fir_f32(void *arg)          { arm_fir_f32(&fir_f32_s, in.f32, out.f32, dsp_n); }
+static void fir_q31(void *arg)          { arm_fir_q31(&fir_q31_s, in.q31, out.q31, dsp_n); }
+static void fir_q15(void *arg)          { arm_fir_q15(&fir_q15_s, in.q15, out.q15, dsp_n); }
+static void fir_fast_q31(void *arg)     { arm_fir_fast_q31(&fir_q31_s, in.q31, out.q31, dsp_n); }
+static void fir_fast_q15(void *arg)     { arm_fir_fast_q15(&fir_q15_s, in.q15, out.q15, dsp_n); }
+static void biquad_f32(void *arg)       { arm_biquad_cascade_df1_f32(&biquad_f32_s, in.f32, out.f32, dsp_n); }
+static void biquad_q31(void *arg)       { arm_biquad_cascade_df1_q31(&biquad_q31_s, in.q31, out.q31, dsp_n); }
+static void biquad_q15(void *arg)       { arm_biquad_cascade_df1_q15(&biquad_q15_s, in.q15, out.q15, dsp_n); }
+static void biquad_fast_q31(void *arg)  { arm_biquad_cascade_df1_fast_q31(&biquad_q31_s, in.q31, out.q31, dsp_n); }
+static void biquad_fast_q15(void *arg)  { arm_biquad_cascade_df1_fast_q15(&biquad_q15_s, in.q15, out.q15, dsp_n); }
+static void df2T_f32(void *arg)         { arm_biquad_cascade_df2T_f32(&df2T_f32_s, in.f32, out.f32, dsp_n); }
+static void cfft_f32(void *arg)         { arm_cfft_f32(cfft_f32_s, in.f32, 0, 1); }
+static void cfft_q31(void *arg)         { arm_cfft_q31(cfft_q31_s, in.q31, 0, 1); }
+static void cfft_q15(void *arg)         { arm_cfft_q15(cfft_q15_s, in.q15, 0, 1); }
+static void rfft_f32(void *arg)         { arm_rfft_fast_f32(&rfft_f32_s, in.f32, out.f32, 0); }
+static void rfft_q31(void *arg)         { arm_rfft_q31(&rfft_q31_s, in.q31, out.q31); }
+static void rfft_q15(void *arg)         { arm_rfft_q15(&rfft_q15_s, in.q15, out.q15); }
+static void mat_f32(void *arg)          { arm_mat_mult_f32(&mat_f32_s[0], &mat_f32_s[1], &mat_f32_s[2]); }
+static void mat_q31(void *arg)          { arm_mat_mult_q31(&mat_q31_s[0], &mat_q31_s[1], &mat_q31_s[2]); }
+static void mat_q15(void *arg)          { arm_mat_mult_q15(&mat_q15_s[0], &mat_q15_s[1], &mat_q15_s[2], state.q15); }
+static void mat_fast_q31(void *arg)     { arm_mat_mult_fast_q31(&mat_q31_s[0], &mat_q31_s[1], &mat_q31_s[2]); }
+static void mat_fast_q15(void *arg)     { arm_mat_mult_fast_q15(&mat_q15_s[0], &mat_q15_s[1], &mat_q15_s[2], state.q15); }
+
+
+/**
+ * @brief Input buffer and FIR taps, pseudo random +-0.25
+ */
+static void dsp_fill(int type)
+{
+  uint32_t seed = 12345;
+
+  for (int i = 0; i < 2 * DSP_MAX_N + DSP_TAPS; i++)
+  {
+    int16_t v;
+
+    seed = seed * 1664525 + 1013904223;
+    v = (int16_t)(seed >> 16) >> 2;
+    if (i >= 2 * DSP_MAX_N)
+    {
+      coef_f32[i - 2 * DSP_MAX_N] = v / 32768.0f;
+      coef_q31[i - 2 * DSP_MAX_N] = (q31_t)v << 16;
+      coef_q15[i - 2 * DSP_MAX_N] = v;
+    }
+    else if (type == DSP_F32)
+      in.f32[i] = v / 32768.0f;
+    else if (type == DSP_Q31)
+      in.q31[i] = (q31_t)v << 16;
+    else
+      in.q15[i] = v;
+  }
+}
+
+
+static int setup_fir(int type, uint16_t n)
+{
+  if (type == DSP_F32)
+    arm_fir_init_f32(&fir_f32_s, DSP_TAPS, coef_f32, state.f32, n);
+  else if (type == DSP_Q31)
+    arm_fir_init_q31(&fir_q31_s, DSP_TAPS, coef_q31, state.q31, n);
+  else
+    return arm_fir_init_q15(&fir_q15_s, DSP_TAPS, coef_q15, state.q15, n) == ARM_MATH_SUCCESS;
+  return 1;
+}
+
+
+/**
+ * @brief DSP_STAGES stable low-pass sections, b0 b1 b2 a1 a2
+ */
+static int setup_biquad(int type, uint16_t n)
+{
+  static const float32_t ba[5] = { 0.2f, 0.4f, 0.2f, 0.3f, -0.2f };
+
+  for (int i = 0; i < DSP_STAGES; i++)
+  {
+    for (int j = 0; j < 5; j++)
+    {
+      coef_f32[i * 5 + j] = ba[j];
+      coef_q31[i * 5 + j] = (q31_t)(ba[j] * 2147483648.0f);
+      coef_q15[i * 6 + j + (j > 0)] = (q15_t)(ba[j] * 32768.0f);
+    }
+    coef_q15[i * 6 + 1] = 0;  // q15 layout b0 0 b1 b2 a1 a2
+  }
+
+  if (type == DSP_F32)
+    arm_biquad_cascade_df1_init_f32(&biquad_f32_s, DSP_STAGES, coef_f32, state.f32);
+  else if (type == DSP_Q31)
+    arm_biquad_cascade_df1_init_q31(&biquad_q31_s, DSP_STAGES, coef_q31, state.q31, 0);
+  else
+    arm_biquad_cascade_df1_init_q15(&biquad_q15_s, DSP_STAGES, coef_q15, state.q15, 0);
+  return 1;
+}
+
+
+static int setup_df2T(int type, uint16_t n)
+{
+  setup_biquad(type, n);
+  arm_biquad_cascade_df2T_init_f32(&df2T_f32_s, DSP_STAGES, coef_f32, state.f32);
+  return 1;
+}
+
+
+static int setup_cfft(int type, uint16_t n)
+{
+  int i;
+
+  for (i = 0; i < DSP_SIZES && (32u << i) != n; i++);
+  if (i == DSP_SIZES)
+    return 0;
+
+  cfft_f32_s = cfft_f32_len[i];
+  cfft_q31_s = cfft_q31_len[i];
+  cfft_q15_s = cfft_q15_len[i];
+  return 1;
+}
+
+
+static int setup_rfft(int type, uint16_t n)
+{
+  arm_status status;
+
+  if (type == DSP_F32)
+    status = arm_rfft_fast_init_f32(&rfft_f32_s, n);
+  else if (type == DSP_Q31)
+    status = arm_rfft_init_q31(&rfft_q31_s, n, 0, 1);
+  else
+    status = arm_rfft_init_q15(&rfft_q15_s, n, 0, 1);
+  return status == ARM_MATH_SUCCESS;
+}
+
+
+/**
+ * @brief A and B in input buffer, C in output buffer
+ */
+static int setup_mat(int type, uint16_t n)
+{
+  if (type == DSP_F32)
+  {
+    arm_mat_init_f32(&mat_f32_s[0], n, n, &in.f32[0]);
+    arm_mat_init_f32(&mat_f32_s[1], n, n, &in.f32[DSP_MAX_N]);
+    arm_mat_init_f32(&mat_f32_s[2], n, n, out.f32);
+  }
+  else if (type == DSP_Q31)
+  {
+    arm_mat_init_q31(&mat_q31_s[0], n, n, &in.q31[0]);
+    arm_mat_init_q31(&mat_q31_s[1], n, n, &in.q31[DSP_MAX_N]);
+    arm_mat_init_q31(&mat_q31_s[2], n, n, out.q31);
+  }
+  else
+  {
+    arm_mat_init_q15(&mat_q15_s[0], n, n, &in.q15[0]);
+    arm_mat_init_q15(&mat_q15_s[1], n, n, &in.q15[DSP_MAX_N]);
+    arm_mat_init_q15(&mat_q15_s[2], n, n, out.q15);
+  }
+  return n * n <= DSP_MAX_N;
+}
+
+
+/**
+ * @brief Run all kernels, print BENCH CSV and cycles/sample table
+ *        to ITM Stimulus Port 0. Takes some seconds
+ */
+void PROF_DSP_BENCH_Run(void)
+{
+  PROF_BENCH_Result_t r;
+  char name[32];
+  int count = 0;
+  int k, s, t;
+
+  PROF_BENCH_Begin();
+  for (k = 0; k < DSP_KERNELS; k++)
+  {
+    for (s = 0; s < DSP_SIZES; s++)
+    {
+      uint16_t n = kernel[k].size[s];
+
+      for (t = 0; t < DSP_TYPES; t++)
+      {
+        result[k][s][t] = -1;
+        if (!n || !kernel[k].fn[t])
+          continue;
+
+        dsp_fill(t);
+        dsp_n = n;
+        if (!kernel[k].setup(t, n))
+          continue;
+
+        PROF_BENCH_Measure(kernel[k].fn[t], NULL, 0, &r);
+        snprintf(name, sizeof(name), "%s_%s/%u", kernel[k].name, type_name[t], n);
+        PROF_BENCH_Print(name, &r);
+        result[k][s][t] = r.cycles / (kernel[k].square ? n * n : n);
+        count++;
+      }
+    }
+  }
+  PROF_BENCH_End(count);
+
+  DEBUG_PRINTF("DSP kernels at %u Hz, cycles/sample:\r\n"
+               "--Kernel----------------|-----N-|------f32-|------q31-|------q15-\r\n",
+               (unsigned)SystemCoreClock);
+  for (k = 0; k < DSP_KERNELS; k++)
+  {
+    for (s = 0; s < DSP_SIZES && kernel[k].size[s]; s++)
+    {
+      DEBUG_PRINTF("%-24s|%6u ", kernel[k].name, kernel[k].size[s]);
+      for (t = 0; t < DSP_TYPES; t++)
+      {
+        if (result[k][s][t] < 0)
+          DEBUG_PRINTF("|        - ");
+        else
+          DEBUG_PRINTF("|%9.2f ", result[k][s][t]);
+      }
+      DEBUG_PRINTF("\r\n");
+    }
+  }
+  DEBUG_PRINTF("\r\n");
+}
+
+#endif // PROFILING_DSP_BENCH
@@ -0,0 +1,22 @@
+#ifndef _PROFILING_DSP_BENCH_H
+#define _PROFILING_DSP_BENCH_H
+
+#include "profiling_bench.h"
+
+/**
+ * CMSIS-DSP kernel benchmark suite.
+ * FIR, biquad, FFT and matrix kernels in f32, q31 and q15 timed with
+ * PROF_BENCH_Measure() over block sizes. Needs PROFILING_BENCH and
+ * CMSIS-DSP library (arm_cortexM4lf_math) linked.
+ */
+#if PROFILING_DSP_BENCH && PROFILING_BENCH
+
+void PROF_DSP_BENCH_Run(void);
+
+#else
+
+#define PROF_DSP_BENCH_Run() ((void)0)
+
+#endif // PROFILING_DSP_BENCH
+
+#endif // _PROFILING_DSP_BENCH_H
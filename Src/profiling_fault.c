@@ -0,0 +1,228 @@
+/***********************************************************************
+ File Name    : 'profiling_fault.c'
+ Title        : PROFILER
+ Description  : Fault snapshot.
+                HardFault, MemManage, BusFault and UsageFault handlers
+                are replaced here by entry code that picks the stacked
+                frame (MSP or PSP by EXC_RETURN) and calls
+                PROF_FAULT_Handler(). Snapshot goes to no-init RAM and
+                to ITM Stimulus Port 0, then the core is reset
+                (PROFILING_FAULT_RESET) or stays in loop.
+
+                Examle output:
+                FAULT-SNAPSHOT 37 FA017DB6 00000003 ...
+                FAULT: vector 3, PC 0x08000A52, LR 0x08000A31, xPSR 0x61000000
+                CFSR 0x00008200 HFSR 0x40000000 MMFAR 0xE000ED34 BFAR 0x20010000
+                Last events of "MAIN loop timing":
+                GPIO_WriteBit(...)            :       7234 us
+
+ Target MCU   : STM32
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_fault.h"
+
+#if PROFILING_FAULT_DUMP
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+
+// names of snapshot are printed only from memory of STM32F303xC
+#define FAULT_FLASH_END         (FLASH_BASE + 0x40000)
+#define FAULT_SRAM_END          (SRAM_BASE + 0xA000)
+#define FAULT_CCM_END           (CCMDATARAM_BASE + 0x2000)
+#define FAULT_NAME_LEN          30      // characters read at most
+
+/* Private variables -------------------------------------------------*/
+static PROF_FAULT_t fault PROF_NOINIT;
+
+/* Private function prototypes ---------------------------------------*/
+static void fault_print(const PROF_FAULT_t *f);
+static const char *fault_name(uint32_t addr);
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * Fault entry. R0 - stacked frame, R1 - EXC_RETURN
+ */
+#if defined(__CC_ARM)
+
+__asm void HardFault_Handler(void)
+{
+  IMPORT  PROF_FAULT_Handler
+  TST     LR, #4
+  ITE     EQ
+  MRSEQ   R0, MSP
+  MRSNE   R0, PSP
+  MOV     R1, LR
+  B       PROF_FAULT_Handler
+}
+
+__asm void MemManage_Handler(void)
+{
+  IMPORT  PROF_FAULT_Handler
+  TST     LR, #4
+  ITE     EQ
+  MRSEQ   R0, MSP
+  MRSNE   R0, PSP
+  MOV     R1, LR
+  B       PROF_FAULT_Handler
+}
+
+__asm void BusFault_Handler(void)
+{
+  IMPORT  PROF_FAULT_Handler
+  TST     LR, #4
+  ITE     EQ
+  MRSEQ   R0, MSP
+  MRSNE   R0, PSP
+  MOV     R1, LR
+  B       PROF_FAULT_Handler
+}
+
+__asm void UsageFault_Handler(void)
+{
+  IMPORT  PROF_FAULT_Handler
+  TST     LR, #4
+  ITE     EQ
+  MRSEQ   R0, MSP
+  MRSNE   R0, PSP
+  MOV     R1, LR
+  B       PROF_FAULT_Handler
+}
+
+#else
+
+// reached only from asm of entry code, kept with PROFILER_LTO
+void PROF_FAULT_Handler(uint32_t *frame, uint32_t exc_return) __attribute__((used));
+
+#define FAULT_ENTRY(name)                                   \
+__attribute__((naked)) void name(void)                      \
+{                                                           \
+  __ASM volatile ("tst   lr, #4            \n"              \
+                  "ite   eq                \n"              \
+                  "mrseq r0, msp           \n"              \
+                  "mrsne r0, psp           \n"              \
+                  "mov   r1, lr            \n"              \
+                  "b     PROF_FAULT_Handler\n");            \
+}
+
+FAULT_ENTRY(HardFault_Handler)
+FAULT_ENTRY(MemManage_Handler)
+FAULT_ENTRY(BusFault_Handler)
+FAULT_ENTRY(UsageFault_Handler)
+
+#endif
+
+
+/**
+ * @brief Save and print fault snapshot
+ *
+ * @param frame      Stacked R0-R3, R12, LR, PC, xPSR
+ * @param exc_return EXC_RETURN of fault handler
+ */
+void PROF_FAULT_Handler(uint32_t *frame, uint32_t exc_return)
+{
+  const char *name;
+  const char *event[PROFILING_FAULT_EVENTS];
+
+  fault.vector = SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk;
+  fault.r0   = frame[0];
+  fault.r1   = frame[1];
+  fault.r2   = frame[2];
+  fault.r3   = frame[3];
+  fault.r12  = frame[4];
+  fault.lr   = frame[5];
+  fault.pc   = frame[6];
+  fault.xpsr = frame[7];
+  fault.exc_return = exc_return;
+  fault.sp    = (uint32_t)frame;
+  fault.cfsr  = SCB->CFSR;
+  fault.hfsr  = SCB->HFSR;
+  fault.mmfar = SCB->MMFAR;
+  fault.bfar  = SCB->BFAR;
+  fault.cyccnt = DWT->CYCCNT;
+  fault.core_clock = SystemCoreClock;
+  fault.event_count = PROFILING_GET_EVENTS(&name, fault.event_time, event, PROFILING_FAULT_EVENTS);
+  fault.prof_name = (uint32_t)name;
+  for (int i = 0; i < PROFILING_FAULT_EVENTS; i++)
+    fault.event_name[i] = (i < fault.event_count) ? (uint32_t)event[i] : 0;
+  fault.magic = PROF_FAULT_MAGIC;
+
+  fault_print(&fault);
+
+#if PROFILING_FAULT_RESET
+  NVIC_SystemReset();
+#endif
+  while (1)
+  {
+  }
+}
+
+
+/**
+ * @brief Print snapshot saved before last reset and clear it.
+ *        Call once on boot
+ */
+void PROF_FAULT_Report(void)
+{
+  if (fault.magic != PROF_FAULT_MAGIC)
+    return;
+
+  DEBUG_PRINTF("Fault before last reset:\r\n");
+  fault_print(&fault);
+  fault.magic = 0;
+}
+
+
+/**
+ * @brief Name pointer of snapshot. Corrupted session or stale no-init
+ *        RAM may hold any value, it is dereferenced only inside flash,
+ *        SRAM or CCM RAM
+ *
+ * @return Name, "?" if out of memory bounds
+ */
+static const char *fault_name(uint32_t addr)
+{
+  if ((addr >= FLASH_BASE && addr <= FAULT_FLASH_END - FAULT_NAME_LEN) ||
+      (addr >= SRAM_BASE && addr <= FAULT_SRAM_END - FAULT_NAME_LEN) ||
+      (addr >= CCMDATARAM_BASE && addr <= FAULT_CCM_END - FAULT_NAME_LEN))
+    return (const char *)addr;
+  return "?";
+}
+
+
+/**
+ * @brief Print snapshot, raw line for host decoder first, then human
+ *        readable part that dereferences names
+ */
+static void fault_print(const PROF_FAULT_t *f)
+{
+  const uint32_t *w = (const uint32_t *)f;
+  uint32_t tick_per_1us = f->core_clock / 1000000;
+
+  if (tick_per_1us == 0)
+    tick_per_1us = 1;
+
+  DEBUG_PRINTF("FAULT-SNAPSHOT %u", (unsigned)(sizeof(PROF_FAULT_t) / sizeof(uint32_t)));
+  for (uint32_t i = 0; i < sizeof(PROF_FAULT_t) / sizeof(uint32_t); i++)
+    DEBUG_PRINTF(" %08X", (unsigned)w[i]);
+  DEBUG_PRINTF("\r\n");
+
+  DEBUG_PRINTF("FAULT: vector %u, PC 0x%08X, LR 0x%08X, xPSR 0x%08X\r\n"
+               "CFSR 0x%08X HFSR 0x%08X MMFAR 0x%08X BFAR 0x%08X\r\n",
+               (unsigned)f->vector, (unsigned)f->pc, (unsigned)f->lr, (unsigned)f->xpsr,
+               (unsigned)f->cfsr, (unsigned)f->hfsr, (unsigned)f->mmfar, (unsigned)f->bfar);
+  if (f->prof_name)
+  {
+    DEBUG_PRINTF("Last events of \"%.30s\":\r\n", fault_name(f->prof_name));
+    for (uint32_t i = 0; i < f->event_count && i < PROFILING_FAULT_EVENTS; i++)
+      DEBUG_PRINTF("%-30.30s:%9u us\r\n", fault_name(f->event_name[i]),
+                   (unsigned)(f->event_time[i] / tick_per_1us));
+  }
+  DEBUG_PRINTF("\r\n");
+}
+
+#endif // PROFILING_FAULT_DUMP
@@ -0,0 +1,43 @@
+#ifndef _PROFILING_FAULT_H
+#define _PROFILING_FAULT_H
+
+#include "profiling.h"
+
+/**
+ * Fault snapshot.
+ * Fault handlers save stacked registers, fault status registers and last
+ * PROFILING_FAULT_EVENTS events of current session to no-init RAM and
+ * print them to ITM. Snapshot survives reset, PROF_FAULT_Report() prints
+ * it on next boot. Raw "FAULT-SNAPSHOT" line is decoded by
+ * Tools/fault_decode.py.
+ */
+#if PROFILING_FAULT_DUMP
+
+#define PROF_FAULT_MAGIC        0xFA017DB6
+
+typedef struct
+{
+  uint32_t magic;
+  uint32_t vector;        // active exception number
+  uint32_t r0, r1, r2, r3, r12, lr, pc, xpsr; // stacked frame
+  uint32_t exc_return;
+  uint32_t sp;            // stacked frame address
+  uint32_t cfsr, hfsr, mmfar, bfar;
+  uint32_t cyccnt;        // DWT_CYCCNT at fault
+  uint32_t core_clock;    // SystemCoreClock at fault
+  uint32_t prof_name;     // current session name, 0 if none
+  uint32_t event_count;
+  uint32_t event_time[PROFILING_FAULT_EVENTS]; // cycles from session start
+  uint32_t event_name[PROFILING_FAULT_EVENTS];
+} PROF_FAULT_t;
+
+void PROF_FAULT_Handler(uint32_t *frame, uint32_t exc_return);
+void PROF_FAULT_Report(void);
+
+#else
+
+#define PROF_FAULT_Report()     ((void)0)
+
+#endif // PROFILING_FAULT_DUMP
+
+#endif // _PROFILING_FAULT_H
@@ -0,0 +1,345 @@
+/***********************************************************************
+ File Name    : 'profiling_flash.c'
+ Title        : PROFILER
+ Description  : Capture log in internal flash.
+                PROFILING_FLASH_LOG_PAGES pages are used as ring of
+                append-only segments. Each page starts with header
+                (magic, sequence number). Page with highest sequence is
+                current, when it is full the oldest page is erased and
+                becomes current, so all pages wear equally.
+
+                Record: | length | payload ... | commit |
+                Commit halfword is programmed last. Record torn by power
+                fail has no commit and is skipped on read, its length
+                still gives the start of next record.
+                Flash is accessed through profiling_flash_port.h, the
+                host build runs the log on RAM simulator (Host/host_flash.c).
+
+ Target MCU   : STM32F30x
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_flash.h"
+#include "profiling_flash_port.h"
+#include <string.h>
+
+#if PROFILING_FLASH_LOG
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+
+#define FLOG_PAGE_SIZE    PROF_FLASH_PAGE_SIZE
+#define FLOG_PAGE_MAGIC   0x4C50  // "PL"
+#define FLOG_COMMIT       0x5AA5
+#define FLOG_EMPTY        0xFFFF
+#define FLOG_HEADER_SIZE  8       // magic, reserved, sequence
+#define FLOG_PAGE_ADDR(p) (PROF_FLASH_PortBase() + (p) * FLOG_PAGE_SIZE)
+#define FLOG_HW(addr)     (*(__IO uint16_t *)(addr))
+#define FLOG_SEQ(p)       (*(__IO uint32_t *)(FLOG_PAGE_ADDR(p) + 4))
+
+typedef struct
+{
+  uint32_t core_clock;
+  uint16_t event_count;
+  uint16_t reserved;
+  char     name[PROFILING_FLASH_NAME_LEN];
+} flog_head_t;
+
+typedef struct
+{
+  uint32_t time;          // cycles from session start
+  char     name[PROFILING_FLASH_NAME_LEN];
+} flog_event_t;
+
+typedef struct
+{
+  flog_head_t  head;
+  flog_event_t event[MAX_EVENT_COUNT];
+} flog_capture_t;
+
+/* Private variables -------------------------------------------------*/
+static flog_capture_t stage;      // capture waiting for flush
+static uint16_t       stage_len;  // 0 - stage empty
+static uint16_t       dropped;    // captures lost, stage was busy
+static uint8_t        cur_page;
+static uint16_t       cur_off;    // write offset in current page
+static uint8_t        ready;
+
+/* Private function prototypes ---------------------------------------*/
+static uint8_t  flog_valid_page(uint8_t page);
+static uint16_t flog_scan_page(uint8_t page);
+static uint8_t  flog_open_page(uint8_t page, uint32_t seq);
+static uint8_t  flog_program(uintptr_t addr, const uint16_t *data, uint16_t len);
+static uint16_t flog_walk(uint8_t print);
+static void     flog_name(char *dst, const char *src);
+static void     flog_print(const flog_capture_t *c);
+/* -------------------------------------------------------------------*/
+
+
+static uint8_t flog_valid_page(uint8_t page)
+{
+  return FLOG_HW(FLOG_PAGE_ADDR(page)) == FLOG_PAGE_MAGIC;
+}
+
+
+/**
+ * @brief Find free space offset in page
+ */
+static uint16_t flog_scan_page(uint8_t page)
+{
+  uintptr_t base = FLOG_PAGE_ADDR(page);
+  uint16_t off = FLOG_HEADER_SIZE;
+  uint16_t len;
+
+  while (off + 4 <= FLOG_PAGE_SIZE)
+  {
+    len = FLOG_HW(base + off);
+    if (len == FLOG_EMPTY)
+      return off;
+    if ((len & 1) || len > FLOG_PAGE_SIZE - off - 4)
+      break;  // corrupted length, no more writes in this page
+    off += len + 4;
+  }
+  return FLOG_PAGE_SIZE;
+}
+
+
+/**
+ * @brief Erase page and write header
+ */
+static uint8_t flog_open_page(uint8_t page, uint32_t seq)
+{
+  uint16_t magic = FLOG_PAGE_MAGIC;
+  uint16_t seq_hw[2] = { (uint16_t)seq, (uint16_t)(seq >> 16) };
+
+  if (!PROF_FLASH_PortErase(FLOG_PAGE_ADDR(page)))
+    return 0;
+  // sequence first, magic last: page is valid only with full header
+  if (!flog_program(FLOG_PAGE_ADDR(page) + 4, seq_hw, 4) ||
+      !flog_program(FLOG_PAGE_ADDR(page), &magic, 2))
+    return 0;
+
+  cur_page = page;
+  cur_off = FLOG_HEADER_SIZE;
+  return 1;
+}
+
+
+static uint8_t flog_program(uintptr_t addr, const uint16_t *data, uint16_t len)
+{
+  for (uint16_t i = 0; i < len / 2; i++)
+  {
+    if (!PROF_FLASH_PortProgram(addr + i * 2, data[i]))
+      return 0;
+  }
+  return 1;
+}
+
+
+/**
+ * @brief Find current page and write position. Call once on boot
+ */
+void PROF_FLASH_Init(void)
+{
+  uint32_t seq = 0;
+  uint8_t found = 0;
+
+  for (uint8_t p = 0; p < PROFILING_FLASH_LOG_PAGES; p++)
+  {
+    if (flog_valid_page(p) && (!found || (int32_t)(FLOG_SEQ(p) - seq) > 0))
+    {
+      seq = FLOG_SEQ(p);
+      cur_page = p;
+      found = 1;
+    }
+  }
+
+  if (found)
+  {
+    cur_off = flog_scan_page(cur_page);
+    ready = 1;
+    return;
+  }
+
+  PROF_FLASH_PortUnlock();
+  ready = flog_open_page(0, 1);
+  PROF_FLASH_PortLock();
+}
+
+
+/**
+ * @brief Copy current session to stage buffer. Called from PROFILING_STOP
+ */
+void PROF_FLASH_Save(void)
+{
+  const char *name;
+  const char *event[MAX_EVENT_COUNT];
+  uint32_t time[MAX_EVENT_COUNT];
+  uint8_t count;
+
+  if (stage_len)
+  {
+    dropped++;
+    return;
+  }
+
+  count = PROFILING_GET_EVENTS(&name, time, event, MAX_EVENT_COUNT);
+  if (!name)
+    return;
+
+  memset(&stage, 0, sizeof(stage));
+  stage.head.core_clock = SystemCoreClock;
+  stage.head.event_count = count;
+  flog_name(stage.head.name, name);
+  for (int i = 0; i < count; i++)
+  {
+    stage.event[i].time = time[i];
+    flog_name(stage.event[i].name, event[i]);
+  }
+  stage_len = sizeof(flog_head_t) + count * sizeof(flog_event_t);
+}
+
+
+/**
+ * @brief Write staged capture to flash. Does nothing while session runs
+ *
+ * @return 1 if capture was written
+ */
+uint8_t PROF_FLASH_Flush(void)
+{
+  uintptr_t addr;
+  uint16_t commit = FLOG_COMMIT;
+  uint8_t ok;
+
+  if (!ready || !stage_len || PROFILING_IS_RUNNING())
+    return 0;
+
+  PROF_FLASH_PortUnlock();
+
+  ok = 1;
+  if (cur_off + stage_len + 4 > FLOG_PAGE_SIZE)
+    ok = flog_open_page((cur_page + 1) % PROFILING_FLASH_LOG_PAGES, FLOG_SEQ(cur_page) + 1);
+
+  if (ok)
+  {
+    addr = FLOG_PAGE_ADDR(cur_page) + cur_off;
+    cur_off += stage_len + 4;
+    ok = flog_program(addr, &stage_len, 2) &&
+         flog_program(addr + 2, (const uint16_t *)&stage, stage_len) &&
+         flog_program(addr + 2 + stage_len, &commit, 2);
+  }
+  PROF_FLASH_PortLock();
+
+  stage_len = 0;
+  return ok;
+}
+
+
+/**
+ * @brief Walk committed captures, oldest first
+ *
+ * @param print 1 - print captures
+ * @return Number of captures
+ */
+static uint16_t flog_walk(uint8_t print)
+{
+  uint8_t page = cur_page;
+  uintptr_t base;
+  uint16_t off, end, len;
+  uint16_t count = 0;
+
+  for (int n = 0; n < PROFILING_FLASH_LOG_PAGES; n++)
+  {
+    page = (page + 1) % PROFILING_FLASH_LOG_PAGES;
+    if (!flog_valid_page(page))
+      continue;
+
+    base = FLOG_PAGE_ADDR(page);
+    end = flog_scan_page(page);
+    for (off = FLOG_HEADER_SIZE; off < end; off += len + 4)
+    {
+      len = FLOG_HW(base + off);
+      if ((len & 1) || len > FLOG_PAGE_SIZE - off - 4)
+        break;
+      if (FLOG_HW(base + off + 2 + len) != FLOG_COMMIT || len > sizeof(flog_capture_t))
+        continue;
+      count++;
+      if (print)
+        flog_print((const flog_capture_t *)(base + off + 2));
+    }
+  }
+  return count;
+}
+
+
+/**
+ * @brief Print all captures, oldest first, to ITM Stimulus Port 0
+ */
+void PROF_FLASH_Dump(void)
+{
+  DEBUG_PRINTF("Flash log (%u captures dropped):\r\n\r\n", dropped);
+  flog_walk(1);
+}
+
+
+/**
+ * @brief Number of stored captures
+ */
+uint16_t PROF_FLASH_Count(void)
+{
+  return flog_walk(0);
+}
+
+
+/**
+ * @brief Erase log
+ */
+void PROF_FLASH_Erase(void)
+{
+  PROF_FLASH_PortUnlock();
+  for (uint8_t p = 0; p < PROFILING_FLASH_LOG_PAGES; p++)
+    PROF_FLASH_PortErase(FLOG_PAGE_ADDR(p));
+  ready = flog_open_page(0, 1);
+  PROF_FLASH_PortLock();
+}
+
+
+/**
+ * @brief Copy name, truncated to PROFILING_FLASH_NAME_LEN, no terminator
+ *        at full length. dst cleared before
+ */
+static void flog_name(char *dst, const char *src)
+{
+  for (int i = 0; i < PROFILING_FLASH_NAME_LEN && src[i]; i++)
+    dst[i] = src[i];
+}
+
+
+/**
+ * @brief Print capture in PROFILING_STOP table format
+ */
+static void flog_print(const flog_capture_t *c)
+{
+  int32_t tick_per_1us = c->head.core_clock / 1000000;
+  int32_t time_prev = 0;
+  int32_t timestamp;
+
+  if (tick_per_1us == 0)
+    tick_per_1us = 1;
+
+  DEBUG_PRINTF("Profiling \"%.*s\" sequence: \r\n"
+               "--Event-----------------------|--timestamp--|----delta_t---\r\n",
+               PROFILING_FLASH_NAME_LEN, c->head.name);
+  for (int i = 0; i < c->head.event_count && i < MAX_EVENT_COUNT; i++)
+  {
+    timestamp = c->event[i].time / tick_per_1us;
+    DEBUG_PRINTF("%-30.*s:%9d us | +%9d us\r\n", PROFILING_FLASH_NAME_LEN, c->event[i].name,
+                 (int)timestamp, (int)(timestamp - time_prev));
+    time_prev = timestamp;
+  }
+  DEBUG_PRINTF("\r\n");
+}
+
+#endif // PROFILING_FLASH_LOG
@@ -0,0 +1,33 @@
+#ifndef _PROFILING_FLASH_H
+#define _PROFILING_FLASH_H
+
+#include "profiling.h"
+
+/**
+ * Capture log in internal flash.
+ * PROFILING_STOP copies session to RAM stage buffer (PROF_FLASH_Save()),
+ * PROF_FLASH_Flush() writes it to flash later, only when no session is
+ * running. Flash programming stalls the core, never call Flush from
+ * time critical code.
+ */
+#if PROFILING_FLASH_LOG
+
+void     PROF_FLASH_Init(void);
+void     PROF_FLASH_Save(void);
+uint8_t  PROF_FLASH_Flush(void);
+void     PROF_FLASH_Dump(void);
+uint16_t PROF_FLASH_Count(void);
+void     PROF_FLASH_Erase(void);
+
+#else
+
+#define PROF_FLASH_Init()       ((void)0)
+#define PROF_FLASH_Save()       ((void)0)
+__STATIC_INLINE uint8_t PROF_FLASH_Flush(void) { return 0; }
+#define PROF_FLASH_Dump()       ((void)0)
+#define PROF_FLASH_Count()      (0)
+#define PROF_FLASH_Erase()      ((void)0)
+
+#endif // PROFILING_FLASH_LOG
+
+#endif // _PROFILING_FLASH_H
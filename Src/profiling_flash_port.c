@@ -0,0 +1,67 @@
+/***********************************************************************
+ File Name    : 'profiling_flash_port.c'
+ Title        : PROFILER
+ Description  : Capture log flash access, STM32F30x internal flash
+                through StdPeriph FLASH driver. Page erase and half word
+                programming, both stall the core until done.
+
+ Target MCU   : STM32F30x
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_flash_port.h"
+
+#if PROFILING_FLASH_LOG
+
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Address of first log page
+ */
+uintptr_t PROF_FLASH_PortBase(void)
+{
+  return PROFILING_FLASH_LOG_ADDR;
+}
+
+
+/**
+ * @brief Unlock flash controller, clear error flags of previous operation
+ */
+void PROF_FLASH_PortUnlock(void)
+{
+  FLASH_Unlock();
+  FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPERR);
+}
+
+
+void PROF_FLASH_PortLock(void)
+{
+  FLASH_Lock();
+}
+
+
+/**
+ * @brief Erase page
+ *
+ * @return 1 if done
+ */
+uint8_t PROF_FLASH_PortErase(uintptr_t addr)
+{
+  return FLASH_ErasePage(addr) == FLASH_COMPLETE;
+}
+
+
+/**
+ * @brief Program half word, must be erased (0xFFFF)
+ *
+ * @return 1 if done
+ */
+uint8_t PROF_FLASH_PortProgram(uintptr_t addr, uint16_t data)
+{
+  return FLASH_ProgramHalfWord(addr, data) == FLASH_COMPLETE;
+}
+
+#endif // PROFILING_FLASH_LOG
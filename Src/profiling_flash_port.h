@@ -0,0 +1,25 @@
+#ifndef _PROFILING_FLASH_PORT_H
+#define _PROFILING_FLASH_PORT_H
+
+#include "profiling.h"
+
+/**
+ * Flash access of capture log.
+ * Src/profiling_flash_port.c programs STM32F30x internal flash at
+ * PROFILING_FLASH_LOG_ADDR, Host/host_flash.c simulates it in RAM with
+ * erase/program rules of the target and power fail injection.
+ * Log is read through memory mapped addresses from PROF_FLASH_PortBase().
+ */
+#if PROFILING_FLASH_LOG
+
+#define PROF_FLASH_PAGE_SIZE    0x800   // STM32F30x erase page
+
+uintptr_t PROF_FLASH_PortBase(void);
+void      PROF_FLASH_PortUnlock(void);
+void      PROF_FLASH_PortLock(void);
+uint8_t   PROF_FLASH_PortErase(uintptr_t addr);
+uint8_t   PROF_FLASH_PortProgram(uintptr_t addr, uint16_t data);
+
+#endif // PROFILING_FLASH_LOG
+
+#endif // _PROFILING_FLASH_PORT_H
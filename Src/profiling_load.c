@@ -0,0 +1,146 @@
+/***********************************************************************
+ File Name    : 'profiling_load.c'
+ Title        : PROFILER
+ Description  : CPU load meter.
+                Window boundaries come from SysTick (1 ms). Busy time
+                of a window is its DWT_CYCCNT length minus the cycles
+                spent in WFI inside PROF_LOAD_Idle(). This works both
+                when CYCCNT keeps counting in sleep and when it stops.
+                1 ms windows are summed to 100 ms and 1 s windows,
+                last PROFILING_LOAD_HISTORY 100 ms values kept in ring.
+
+                Examle output:
+                CPU load: 1 ms  12.0% | 100 ms   9.4% | 1 s   9.8%
+                100 ms history: 9.1 9.6 9.4 10.2 9.9 9.3 9.4 9.8 10.0 9.4
+
+ Target MCU   : STM32
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_load.h"
+
+#if PROFILING_LOAD_METER
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+
+/* Private variables -------------------------------------------------*/
+static uint32_t window_start;    // CYCCNT at last tick
+static uint32_t idle_cycles;     // sleep cycles in current 1 ms window
+static uint32_t busy_100ms;
+static uint32_t busy_1s;
+static uint16_t ms_count;
+static uint8_t  ring_pos;        // oldest entry in load.history
+static PROF_LOAD_t load;
+
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Enable cycle counter and start first window
+ */
+void PROF_LOAD_Init(void)
+{
+  PROF_CYCCNT_ENABLE();
+  window_start = DWT->CYCCNT;
+}
+
+
+/**
+ * @brief Close 1 ms window. Call from SysTick_Handler
+ */
+void PROF_LOAD_Tick(void)
+{
+  uint32_t now = DWT->CYCCNT;
+  uint32_t window = SystemCoreClock / 1000;
+  uint32_t busy = now - window_start - idle_cycles;
+
+  window_start = now;
+  idle_cycles = 0;
+  if (busy > window)
+    busy = window;
+
+  load.load_1ms = busy * 1000 / window;
+  busy_100ms += busy;
+  busy_1s += busy;
+
+  if (++ms_count % 100)
+    return;
+
+  load.load_100ms = busy_100ms / (window / 10);
+  load.history[ring_pos] = load.load_100ms;
+  if (++ring_pos >= PROFILING_LOAD_HISTORY)
+    ring_pos = 0;
+  busy_100ms = 0;
+
+  if (ms_count < 1000)
+    return;
+
+  load.load_1s = busy_1s / window;
+  busy_1s = 0;
+  ms_count = 0;
+}
+
+
+/**
+ * @brief Sleep until next interrupt and account sleep time as idle.
+ *        Call with interrupts enabled
+ */
+void PROF_LOAD_Idle(void)
+{
+  uint32_t t0;
+
+  // interrupts masked: ISR runs after accounting, not inside idle time
+  __disable_irq();
+  t0 = DWT->CYCCNT;
+  __WFI();
+  idle_cycles += DWT->CYCCNT - t0;
+  __enable_irq();
+}
+
+
+/**
+ * @brief Copy of current load values, history ordered oldest first
+ *
+ * @param dst Destination
+ */
+void PROF_LOAD_Get(PROF_LOAD_t *dst)
+{
+  uint32_t primask = __get_PRIMASK();
+  int pos;
+
+  __disable_irq();
+  *dst = load;
+  pos = ring_pos;
+  for (int i = 0; i < PROFILING_LOAD_HISTORY; i++)
+  {
+    dst->history[i] = load.history[pos];
+    if (++pos >= PROFILING_LOAD_HISTORY)
+      pos = 0;
+  }
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Print CPU load to ITM Stimulus Port 0
+ */
+void PROF_LOAD_Report(void)
+{
+  PROF_LOAD_t cur;
+
+  PROF_LOAD_Get(&cur);
+  DEBUG_PRINTF("CPU load: 1 ms %3u.%u%% | 100 ms %3u.%u%% | 1 s %3u.%u%%\r\n",
+               cur.load_1ms / 10, cur.load_1ms % 10,
+               cur.load_100ms / 10, cur.load_100ms % 10,
+               cur.load_1s / 10, cur.load_1s % 10);
+  DEBUG_PRINTF("100 ms history:");
+  for (int i = 0; i < PROFILING_LOAD_HISTORY; i++)
+    DEBUG_PRINTF(" %u.%u", cur.history[i] / 10, cur.history[i] % 10);
+  DEBUG_PRINTF("\r\n\r\n");
+}
+
+#endif // PROFILING_LOAD_METER
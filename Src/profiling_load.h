@@ -0,0 +1,37 @@
+#ifndef _PROFILING_LOAD_H
+#define _PROFILING_LOAD_H
+
+#include "profiling.h"
+
+/**
+ * CPU load meter.
+ * PROF_LOAD_Tick() from SysTick_Handler (1 kHz) closes 1 ms window,
+ * PROF_LOAD_Idle() replaces idle spin loops and sleeps until interrupt.
+ * Load values are in permille (0..1000).
+ */
+#if PROFILING_LOAD_METER
+
+typedef struct
+{
+  uint16_t load_1ms;
+  uint16_t load_100ms;
+  uint16_t load_1s;
+  uint16_t history[PROFILING_LOAD_HISTORY]; // last 100 ms windows, oldest first
+} PROF_LOAD_t;
+
+void PROF_LOAD_Init(void);
+void PROF_LOAD_Tick(void);
+void PROF_LOAD_Idle(void);
+void PROF_LOAD_Get(PROF_LOAD_t *load);
+void PROF_LOAD_Report(void);
+
+#else
+
+#define PROF_LOAD_Init()        ((void)0)
+#define PROF_LOAD_Tick()        ((void)0)
+#define PROF_LOAD_Idle()        ((void)0)
+#define PROF_LOAD_Report()      ((void)0)
+
+#endif // PROFILING_LOAD_METER
+
+#endif // _PROFILING_LOAD_H
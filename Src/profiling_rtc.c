@@ -0,0 +1,217 @@
+/***********************************************************************
+ File Name    : 'profiling_rtc.c'
+ Title        : PROFILER
+ Description  : RTC anchored wall clock timestamps.
+                Anchor: DWT_CYCCNT (extended to 64 bit) and RTC time in
+                us since 2000-01-01. Core clock is calibrated as cycles
+                between first and last anchor divided by RTC time
+                between them, so accuracy grows with capture length.
+
+                Examle output:
+                Wall clock: 2026-10-18 12:34:56.789062 at session start, drift +12 ppm
+
+ Target MCU   : STM32F30x
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_rtc.h"
+#include "profiling_delay.h"
+
+#if PROFILING_RTC_CLOCK
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+
+#define US_PER_DAY   86400000000ULL
+#define BCD(v)       (((v) >> 4) * 10 + ((v) & 0x0F))
+
+/* Private variables -------------------------------------------------*/
+static uint64_t cyc64;         // extended cycle counter
+static uint32_t cyc_last;
+static uint64_t base_cyc;      // first anchor
+static uint64_t base_us;
+static uint64_t anchor_cyc;    // last anchor
+static uint64_t anchor_us;
+static uint32_t core_clock;    // calibrated cycles per second, 0 - no anchor
+static uint16_t resync_ms;
+
+/* Private function prototypes ---------------------------------------*/
+static uint64_t cyc_extend(uint32_t now);
+static int32_t  days_from_civil(int32_t y, uint32_t m, uint32_t d);
+static void     civil_from_days(int32_t z, int32_t *y, uint32_t *m, uint32_t *d);
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Extend CYCCNT to 64 bit. Must be called at least every 59 s,
+ *        with PROFILING_DELAY its time base keeps the wraps (SysTick
+ *        is no 1 kHz PROF_RTC_Tick() source with PROFILING_TICKLESS)
+ */
+static uint64_t cyc_extend(uint32_t now)
+{
+#if PROFILING_DELAY
+  uint64_t t = PROF_DELAY_Now();
+
+  // time base read after now, step back to it
+  cyc64 = t - ((uint32_t)t - now);
+#else
+  cyc64 += now - cyc_last;
+#endif
+  cyc_last = now;
+  return cyc64;
+}
+
+
+/**
+ * @brief Days since 2000-01-01
+ */
+static int32_t days_from_civil(int32_t y, uint32_t m, uint32_t d)
+{
+  int32_t era;
+  uint32_t yoe, doy, doe;
+
+  y -= m <= 2;
+  era = y / 400;
+  yoe = (uint32_t)(y - era * 400);
+  doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+  doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  return era * 146097 + (int32_t)doe - 730425;
+}
+
+
+static void civil_from_days(int32_t z, int32_t *y, uint32_t *m, uint32_t *d)
+{
+  int32_t era;
+  uint32_t doe, yoe, doy, mp;
+
+  z += 730425;
+  era = z / 146097;
+  doe = (uint32_t)(z - era * 146097);
+  yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  mp = (5 * doy + 2) / 153;
+  *d = doy - (153 * mp + 2) / 5 + 1;
+  *m = mp < 10 ? mp + 3 : mp - 9;
+  *y = (int32_t)yoe + era * 400 + (*m <= 2);
+}
+
+
+/**
+ * @brief Read RTC and cycle counter, update calibration
+ */
+void PROF_RTC_Anchor(void)
+{
+  uint32_t prediv_s, ssr, tr, dr, hours, now, primask;
+  uint64_t us;
+
+  if (!(RTC->ISR & RTC_ISR_INITS))
+    return;
+
+  PROF_CYCCNT_ENABLE();
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  // SSR read locks TR and DR shadow registers until DR is read,
+  // RTC_GetSubSecond() reads DR itself and would unlock them
+  now = DWT->CYCCNT;
+  ssr = RTC->SSR;
+  tr = RTC->TR;
+  dr = RTC->DR;
+  prediv_s = RTC->PRER & RTC_PRER_PREDIV_S;
+
+  hours = BCD((tr >> 16) & 0x3F);
+  if (RTC->CR & RTC_CR_FMT)
+    hours = hours % 12 + ((tr & RTC_TR_PM) ? 12 : 0);
+  us = (uint64_t)days_from_civil(2000 + BCD(dr >> 16 & 0xFF), BCD(dr >> 8 & 0x1F), BCD(dr & 0x3F)) * US_PER_DAY +
+       ((uint64_t)hours * 3600 + BCD(tr >> 8 & 0x7F) * 60 + BCD(tr & 0x7F)) * 1000000 +
+       (uint64_t)(prediv_s - ssr) * 1000000 / (prediv_s + 1);
+
+  anchor_cyc = cyc_extend(now);
+  anchor_us = us;
+  if (!core_clock)
+  {
+    base_cyc = anchor_cyc;
+    base_us = anchor_us;
+    core_clock = SystemCoreClock;
+  }
+  else if (anchor_us - base_us >= 1000000)
+  {
+    core_clock = (uint32_t)((anchor_cyc - base_cyc) * 1000000 / (anchor_us - base_us));
+  }
+
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Periodic resync. Call from SysTick_Handler (1 kHz)
+ */
+void PROF_RTC_Tick(void)
+{
+  if (++resync_ms < PROFILING_RTC_RESYNC_MS)
+    return;
+
+  resync_ms = 0;
+  PROF_RTC_Anchor();
+}
+
+
+/**
+ * @brief Wall clock of cycle counter value within 59 s from last anchor
+ *
+ * @param cyccnt DWT_CYCCNT value
+ *
+ * @return us since 2000-01-01, 0 if RTC is not anchored
+ */
+uint64_t PROF_RTC_Wall(uint32_t cyccnt)
+{
+  int32_t delta;
+
+  if (!core_clock)
+    return 0;
+
+  delta = (int32_t)(cyccnt - (uint32_t)anchor_cyc);
+  return anchor_us + (int64_t)delta * 1000000 / core_clock;
+}
+
+
+/**
+ * @brief Core clock drift against RTC
+ *
+ * @return Real minus nominal (SystemCoreClock) frequency, ppm
+ */
+int32_t PROF_RTC_DriftPPM(void)
+{
+  if (!core_clock)
+    return 0;
+
+  return (int32_t)(((int64_t)core_clock - SystemCoreClock) * 1000000 / SystemCoreClock);
+}
+
+
+/**
+ * @brief Print wall clock of session start to ITM Stimulus Port 0
+ *
+ * @param time_start DWT_CYCCNT at session start
+ */
+void PROF_RTC_Report(uint32_t time_start)
+{
+  uint64_t us = PROF_RTC_Wall(time_start);
+  uint32_t us_of_day, m, d;
+  int32_t y;
+
+  if (!us)
+    return;
+
+  civil_from_days((int32_t)(us / US_PER_DAY), &y, &m, &d);
+  us_of_day = (uint32_t)((us % US_PER_DAY) / 1000000);
+  DEBUG_PRINTF("Wall clock: %04d-%02u-%02u %02u:%02u:%02u.%06u at session start, drift %+d ppm\r\n\r\n",
+               (int)y, (unsigned)m, (unsigned)d,
+               (unsigned)(us_of_day / 3600), (unsigned)(us_of_day / 60 % 60), (unsigned)(us_of_day % 60),
+               (unsigned)(us % 1000000), (int)PROF_RTC_DriftPPM());
+}
+
+#endif // PROFILING_RTC_CLOCK
@@ -0,0 +1,32 @@
+#ifndef _PROFILING_RTC_H
+#define _PROFILING_RTC_H
+
+#include "profiling.h"
+
+/**
+ * RTC anchored wall clock.
+ * Each session start is anchored to RTC date, time and subsecond.
+ * PROF_RTC_Tick() from SysTick_Handler resyncs cycle counter to RTC
+ * every PROFILING_RTC_RESYNC_MS and calibrates real core clock, so
+ * wall clock of cycle timestamp is drift corrected. With PROFILING_DELAY
+ * cycle counter wraps are kept by PROF_DELAY_Now(), so anchors stay
+ * consistent with PROFILING_TICKLESS too (no resync there).
+ * RTC must be configured (clock source, prescalers, calendar) by user.
+ */
+#if PROFILING_RTC_CLOCK
+
+void     PROF_RTC_Anchor(void);
+void     PROF_RTC_Tick(void);
+uint64_t PROF_RTC_Wall(uint32_t cyccnt);
+int32_t  PROF_RTC_DriftPPM(void);
+void     PROF_RTC_Report(uint32_t time_start);
+
+#else
+
+#define PROF_RTC_Anchor()       ((void)0)
+#define PROF_RTC_Tick()         ((void)0)
+#define PROF_RTC_Report(t)      ((void)0)
+
+#endif // PROFILING_RTC_CLOCK
+
+#endif // _PROFILING_RTC_H
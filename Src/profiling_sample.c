@@ -0,0 +1,141 @@
+/***********************************************************************
+ File Name    : 'profiling_sample.c'
+ Title        : PROFILER
+ Description  : Sampled events for high frequency code.
+                Each PROFILING_EVENT_EVERY/AUTO call site has static
+                descriptor with down counter. Only when it reaches zero
+                the event is recorded and counter reloaded: fixed period,
+                or adaptive period which keeps PROFILING_SAMPLE_RATE
+                records per second (doubled when the window budget is
+                spent, recalculated every PROFILING_SAMPLE_WINDOW_MS).
+                seen / recorded is the weight of every recorded event.
+
+                Examle output:
+                Sampled events:
+                --Event-----------------------|---every--|------seen--|--recorded--
+                ADC_IRQ                       :      100 |     100000 |       1000
+                UART_RX byte                  : ~     23 |      11520 |        500
+
+ Target MCU   : STM32
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_sample.h"
+
+#if PROFILING_SAMPLE && PROFILING_ENABLE
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+
+// records per adaptive window
+#define SAMPLE_TARGET   ((PROFILING_SAMPLE_RATE * PROFILING_SAMPLE_WINDOW_MS + 999) / 1000)
+
+/* Private variables -------------------------------------------------*/
+static PROF_SAMPLE_t sample_end; // list terminator
+static PROF_SAMPLE_t *sample_list = &sample_end;
+
+/* Private function prototypes ---------------------------------------*/
+static uint32_t sample_adapt(PROF_SAMPLE_t *s, uint32_t now);
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Next countdown of adaptive site
+ */
+static uint32_t sample_adapt(PROF_SAMPLE_t *s, uint32_t now)
+{
+  uint32_t window = SystemCoreClock / 1000 * PROFILING_SAMPLE_WINDOW_MS;
+  uint32_t elapsed = now - s->win_start;
+  uint64_t reload;
+
+  if (elapsed >= window)
+  {
+    // occurrences per window / records per window
+    reload = (uint64_t)s->win_seen * window / ((uint64_t)elapsed * SAMPLE_TARGET);
+    s->win_start = now;
+    s->win_seen = 0;
+    s->win_recorded = 0;
+    if (reload > 0x80000000)
+      reload = 0x80000000;
+    return reload ? (uint32_t)reload : 1;
+  }
+
+  // budget of this window spent, back off until it ends
+  if (s->win_recorded >= SAMPLE_TARGET && s->reload < 0x80000000)
+    return s->reload * 2;
+
+  return s->reload;
+}
+
+
+/**
+ * @brief Counter of call site reached zero. Record event, reload counter
+ *
+ * @param s Call site descriptor
+ */
+void PROF_SAMPLE_Hit(PROF_SAMPLE_t *s)
+{
+  uint32_t now = DWT->CYCCNT;
+  uint32_t primask;
+
+  if (s->next == NULL)
+  {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    s->next = sample_list;
+    sample_list = s;
+    s->win_start = now;
+    if (!primask)
+      __enable_irq();
+  }
+
+  s->seen += s->reload;
+  s->win_seen += s->reload;
+  // dropped events (no session, table full) are only seen
+  if (PROF_Event(s->name))
+  {
+    s->recorded++;
+    s->win_recorded++;
+  }
+
+  s->reload = s->period ? s->period : sample_adapt(s, now);
+  s->countdown = s->reload;
+}
+
+
+/**
+ * @brief Clear counters of all sites. Called from PROFILING_START
+ */
+void PROF_SAMPLE_Reset(void)
+{
+  for (PROF_SAMPLE_t *s = sample_list; s != &sample_end; s = s->next)
+  {
+    // occurrences already counted down belong to previous session
+    s->seen = s->countdown - s->reload;
+    s->recorded = 0;
+  }
+}
+
+
+/**
+ * @brief Print sampled events to ITM Stimulus Port 0
+ */
+void PROF_SAMPLE_Report(void)
+{
+  if (sample_list == &sample_end)
+    return;
+
+  DEBUG_PRINTF("Sampled events:\r\n"
+               "--Event-----------------------|---every--|------seen--|--recorded--\r\n");
+  for (PROF_SAMPLE_t *s = sample_list; s != &sample_end; s = s->next)
+  {
+    DEBUG_PRINTF("%-30s: %c%8u | %10u | %10u\r\n", s->name, s->period ? ' ' : '~',
+                 (unsigned)s->reload, (unsigned)(s->seen + (s->reload - s->countdown)),
+                 (unsigned)s->recorded);
+  }
+  DEBUG_PRINTF("\r\n");
+}
+
+#endif // PROFILING_SAMPLE
@@ -0,0 +1,53 @@
+#ifndef _PROFILING_SAMPLE_H
+#define _PROFILING_SAMPLE_H
+
+#include "profiling.h"
+
+/**
+ * Sampled events for high frequency code.
+ * PROFILING_EVENT_EVERY(event, n) records every n-th occurrence,
+ * PROFILING_EVENT_AUTO(event) adapts n to keep PROFILING_SAMPLE_RATE
+ * records per second. Hot path is one decrement and branch, all
+ * occurrences are counted, so PROFILING_STOP prints seen/recorded ratio.
+ * With PROFILING_SAMPLE == 0 every occurrence is a plain PROFILING_EVENT.
+ */
+#if PROFILING_SAMPLE && PROFILING_ENABLE
+
+typedef struct PROF_SAMPLE_s
+{
+  const char *name;     // event name
+  uint32_t   period;    // record every period-th, 0 - adaptive
+  uint32_t   countdown; // occurrences left until next record
+  uint32_t   reload;    // last loaded countdown
+  uint32_t   seen;      // counted occurrences, without current countdown
+  uint32_t   recorded;  // recorded occurrences
+  uint32_t   win_start; // adaptive window start, cycles
+  uint32_t   win_seen;  // occurrences in window
+  uint32_t   win_recorded; // records in window
+  struct PROF_SAMPLE_s *next; // registered sites list
+} PROF_SAMPLE_t;
+
+#define PROFILING_EVENT_EVERY(event, n)                             \
+  do {                                                              \
+    static PROF_SAMPLE_t prof_sample_ = { (event), (n), 1, 1 };     \
+    if (--prof_sample_.countdown == 0)                              \
+      PROF_SAMPLE_Hit(&prof_sample_);                               \
+  } while (0)
+
+#define PROFILING_EVENT_AUTO(event)     PROFILING_EVENT_EVERY(event, 0)
+
+void PROF_SAMPLE_Hit(PROF_SAMPLE_t *s);
+void PROF_SAMPLE_Reset(void);
+void PROF_SAMPLE_Report(void);
+
+#else
+
+#define PROFILING_EVENT_EVERY(event, n) PROFILING_EVENT(event)
+#define PROFILING_EVENT_AUTO(event)     PROFILING_EVENT(event)
+
+#define PROF_SAMPLE_Reset()     ((void)0)
+#define PROF_SAMPLE_Report()    ((void)0)
+
+#endif // PROFILING_SAMPLE
+
+#endif // _PROFILING_SAMPLE_H
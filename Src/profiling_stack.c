@@ -0,0 +1,97 @@
+/***********************************************************************
+ File Name    : 'profiling_stack.c'
+ Title        : PROFILER
+ Description  : Stack high-water mark per profiling session.
+                Unused stack (from the bottom up to SP minus
+                PROFILING_STACK_MARGIN) is filled with
+                PROFILING_STACK_PATTERN on session start. On stop the
+                first overwritten word gives the peak stack usage.
+
+                Examle output:
+                Stack: peak 412 of 1024 bytes (40%)
+
+ Target MCU   : STM32
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_stack.h"
+
+#if PROFILING_STACK_WATERMARK
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+
+#if defined(__CC_ARM)
+extern uint32_t Stack_Mem;               // startup_stm32f303xc.s
+#define STACK_BOTTOM  (&Stack_Mem)
+#else
+extern uint32_t __StackLimit;            // linker script
+#define STACK_BOTTOM  (&__StackLimit)
+#endif
+#define STACK_TOP     ((uint32_t *)(*(uint32_t *)SCB->VTOR)) // initial SP from vector table
+
+/* Private variables -------------------------------------------------*/
+static uint8_t stack_painted;
+
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Fill unused stack with pattern. Interrupts masked: an ISR frame
+ *        below SP would be overwritten (~3 cycles per word)
+ */
+void PROF_STACK_Paint(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t *p = STACK_BOTTOM;
+  uint32_t *end;
+
+  __disable_irq();
+  end = (uint32_t *)(__get_MSP() - PROFILING_STACK_MARGIN);
+  while (p < end)
+    *p++ = PROFILING_STACK_PATTERN;
+  if (!primask)
+    __enable_irq();
+  stack_painted = 1;
+}
+
+
+/**
+ * @brief Peak stack usage since last PROF_STACK_Paint()
+ *
+ * @return Used bytes. Stack size if stack bottom is overwritten (overflow)
+ */
+uint32_t PROF_STACK_Peak(void)
+{
+  uint32_t *p = STACK_BOTTOM;
+  uint32_t *top = STACK_TOP;
+
+  while (p < top && *p == PROFILING_STACK_PATTERN)
+    p++;
+
+  return (uint32_t)(top - p) * sizeof(uint32_t);
+}
+
+
+/**
+ * @brief Print peak stack usage to ITM Stimulus Port 0
+ */
+void PROF_STACK_Report(void)
+{
+  uint32_t size = (uint32_t)(STACK_TOP - STACK_BOTTOM) * sizeof(uint32_t);
+  uint32_t peak;
+
+  if (!stack_painted)
+    return;
+
+  peak = PROF_STACK_Peak();
+  if (peak >= size)
+    DEBUG_PRINTF("Stack: OVERFLOW, %u bytes stack exhausted\r\n\r\n", (unsigned)size);
+  else
+    DEBUG_PRINTF("Stack: peak %u of %u bytes (%u%%)\r\n\r\n", (unsigned)peak, (unsigned)size,
+                 (unsigned)(peak * 100 / size));
+}
+
+#endif // PROFILING_STACK_WATERMARK
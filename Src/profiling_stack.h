@@ -0,0 +1,24 @@
+#ifndef _PROFILING_STACK_H
+#define _PROFILING_STACK_H
+
+#include "profiling.h"
+
+/**
+ * Stack high-water mark.
+ * PROFILING_START paints unused stack, PROFILING_STOP reports peak usage.
+ */
+#if PROFILING_STACK_WATERMARK
+
+void     PROF_STACK_Paint(void);
+uint32_t PROF_STACK_Peak(void);
+void     PROF_STACK_Report(void);
+
+#else
+
+#define PROF_STACK_Paint()      ((void)0)
+#define PROF_STACK_Peak()       (0)
+#define PROF_STACK_Report()     ((void)0)
+
+#endif // PROFILING_STACK_WATERMARK
+
+#endif // _PROFILING_STACK_H
@@ -0,0 +1,295 @@
+/***********************************************************************
+ File Name    : 'profiling_trig.c'
+ Title        : PROFILER
+ Description  : Trigger capture, pre/post trigger event ring.
+                Armed: PROFILING_EVENT() writes name, time and delta_t
+                to a PROFILING_TRIG_RING entry ring and checks the rules,
+                PROFILING_STOP() does not print the event table.
+                Rule matches event by name pointer (NULL - any event),
+                fires when delta_t > threshold and predicate (if set)
+                returns nonzero. delta_t is from previous event or
+                PROFILING_START() of the same context, as in the event
+                table. Only events of running sessions are recorded.
+                After trigger post more events are recorded, then the
+                ring is frozen until printed by PROF_TRIG_Report() and
+                armed again. Normal case output is nothing.
+
+                Examle output:
+                Trigger 1, rule 0: "Wait for update Tick" +1012 us > 900 us
+                --Event-----------------------|--timestamp--|----delta_t---
+                DELAY 1 s                     :    -1014 us | +   999998 us
+                GPIO_WriteBit(...)            :    -1012 us | +        2 us
+                Wait for update Tick          :        0 us | +     1012 us <- trigger
+                DELAY 1 s                     :  1000001 us | +  1000001 us
+
+ Target MCU   : STM32
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_trig.h"
+#include "profiling_ctx.h"
+
+#if PROFILING_TRIGGER
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+
+#define TRIG_MASK     (PROFILING_TRIG_RING - 1)
+
+#if (PROFILING_TRIG_RING & TRIG_MASK) || PROFILING_TRIG_RING > 256
+#error "PROFILING_TRIG_RING must be power of 2, up to 256"
+#endif
+
+#define TRIG_IDLE     0
+#define TRIG_ARMED    1   // recording, rules checked
+#define TRIG_POST     2   // triggered, recording post events
+#define TRIG_FROZEN   3   // capture complete, waiting for report
+
+typedef struct
+{
+  const char   *event;    // NULL - any event
+  uint32_t     threshold; // cycles
+  PROF_TRIG_Fn fn;
+  uint8_t      used;
+} trig_rule_t;
+
+typedef struct
+{
+  const char *name;
+  uint32_t   time;
+  uint32_t   delta;
+} trig_entry_t;
+
+/* Private variables -------------------------------------------------*/
+static trig_rule_t  rule[PROFILING_TRIG_RULES];
+static trig_entry_t ring[PROFILING_TRIG_RING];
+static volatile uint8_t state;
+static uint8_t  pre_n;
+static uint8_t  post_n;
+static uint8_t  post_left;
+static int8_t   trig_rule;    // -1: PROF_TRIG_Fire()
+static uint32_t head;         // next write, free running
+static uint32_t arm_head;     // head when armed
+static uint32_t trig_pos;     // trigger entry, free running
+static uint32_t prev[PROFILING_CONTEXT_COUNT]; // time of previous event or start
+static uint32_t captures;
+
+/* Private function prototypes ---------------------------------------*/
+static void trig_record(const char *name, uint32_t now, uint32_t delta);
+static void trig_fire(int8_t r);
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Set trigger rule
+ *
+ * @param r            Rule slot 0..PROFILING_TRIG_RULES-1
+ * @param event        Event name pointer as passed to PROFILING_EVENT(),
+ *                     NULL - any event
+ * @param threshold_us Fire when delta_t of event is above, 0 - any
+ * @param fn           Predicate, NULL - threshold only
+ */
+void PROF_TRIG_Rule(uint8_t r, const char *event, uint32_t threshold_us, PROF_TRIG_Fn fn)
+{
+  if (r >= PROFILING_TRIG_RULES)
+    return;
+
+  rule[r].used = 0;
+  rule[r].event = event;
+  rule[r].threshold = threshold_us * (SystemCoreClock / 1000000);
+  rule[r].fn = fn;
+  rule[r].used = 1;
+}
+
+
+/**
+ * @brief Start recording, pre + post + 1 <= PROFILING_TRIG_RING
+ *
+ * @param pre  Events kept before trigger
+ * @param post Events recorded after trigger
+ */
+void PROF_TRIG_Arm(uint8_t pre, uint8_t post)
+{
+  uint32_t primask = __get_PRIMASK();
+
+  if (post > PROFILING_TRIG_RING / 2)
+    post = PROFILING_TRIG_RING / 2;
+  if (pre > PROFILING_TRIG_RING - 1 - post)
+    pre = PROFILING_TRIG_RING - 1 - post;
+
+  PROF_CYCCNT_ENABLE();
+  __disable_irq();
+  pre_n = pre;
+  post_n = post;
+  arm_head = head;
+  for (int i = 0; i < PROFILING_CONTEXT_COUNT; i++)
+    prev[i] = DWT->CYCCNT;
+  state = TRIG_ARMED;
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Stop recording, event table printed by PROFILING_STOP() again
+ */
+void PROF_TRIG_Disarm(void)
+{
+  state = TRIG_IDLE;
+}
+
+
+/**
+ * @brief Armed or capture pending
+ */
+uint8_t PROF_TRIG_Armed(void)
+{
+  return state != TRIG_IDLE;
+}
+
+
+/**
+ * @brief Write ring entry. Interrupts masked
+ */
+static void trig_record(const char *name, uint32_t now, uint32_t delta)
+{
+  trig_entry_t *e = &ring[head & TRIG_MASK];
+
+  e->name = name;
+  e->time = now;
+  e->delta = delta;
+  head++;
+}
+
+
+/**
+ * @brief Last written entry is trigger. Interrupts masked
+ */
+static void trig_fire(int8_t r)
+{
+  trig_rule = r;
+  trig_pos = head - 1;
+  post_left = post_n;
+  state = post_n ? TRIG_POST : TRIG_FROZEN;
+}
+
+
+/**
+ * @brief Session start, reference for delta_t. Called from PROFILING_START
+ */
+void PROF_TRIG_Start(uint32_t now)
+{
+  prev[PROF_CTX_CURRENT()] = now;
+}
+
+
+/**
+ * @brief Record event and check rules. Called from PROFILING_EVENT
+ *        while session of current context is running
+ */
+void PROF_TRIG_Event(const char *event, uint32_t now)
+{
+  uint32_t primask;
+  uint32_t delta;
+  uint32_t *p;
+
+  if (state != TRIG_ARMED && state != TRIG_POST)
+    return;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  p = &prev[PROF_CTX_CURRENT()];
+  delta = now - *p;
+  *p = now;
+  trig_record(event, now, delta);
+
+  if (state == TRIG_ARMED)
+  {
+    for (int i = 0; i < PROFILING_TRIG_RULES; i++)
+    {
+      if (!rule[i].used || (rule[i].event && rule[i].event != event) || delta <= rule[i].threshold)
+        continue;
+      if (rule[i].fn && !rule[i].fn(event, delta))
+        continue;
+      trig_fire(i);
+      break;
+    }
+  }
+  else if (--post_left == 0)
+    state = TRIG_FROZEN;
+
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Trigger now, e.g. from error handler. Reason is recorded as
+ *        trigger entry, delta_t from previous event
+ */
+void PROF_TRIG_Fire(const char *reason)
+{
+  uint32_t primask = __get_PRIMASK();
+  uint32_t now = DWT->CYCCNT;
+
+  __disable_irq();
+  if (state == TRIG_ARMED)
+  {
+    trig_record(reason, now, now - prev[PROF_CTX_CURRENT()]);
+    trig_fire(-1);
+  }
+  if (!primask)
+    __enable_irq();
+}
+
+
+/**
+ * @brief Print frozen capture to ITM Stimulus Port 0 and rearm.
+ *        Called from PROFILING_STOP, nothing printed without capture
+ */
+void PROF_TRIG_Report(void)
+{
+  uint32_t primask;
+  uint32_t avail, first, last;
+  int32_t  cyc_us = SystemCoreClock / 1000000;
+  const trig_entry_t *t, *e;
+
+  if (state != TRIG_FROZEN)
+    return;
+
+  // ring is not written while frozen
+  avail = trig_pos - arm_head;
+  first = trig_pos - (avail < pre_n ? avail : pre_n);
+  last = trig_pos + post_n;
+  t = &ring[trig_pos & TRIG_MASK];
+  captures++;
+
+  if (trig_rule < 0)
+    DEBUG_PRINTF("Trigger %u, fired: \"%s\"\r\n", (unsigned)captures, t->name);
+  else if (rule[trig_rule].fn)
+    DEBUG_PRINTF("Trigger %u, rule %d predicate: \"%s\" +%u us\r\n", (unsigned)captures, trig_rule,
+                 t->name, (unsigned)(t->delta / cyc_us));
+  else
+    DEBUG_PRINTF("Trigger %u, rule %d: \"%s\" +%u us > %u us\r\n", (unsigned)captures, trig_rule,
+                 t->name, (unsigned)(t->delta / cyc_us), (unsigned)(rule[trig_rule].threshold / cyc_us));
+  DEBUG_PRINTF("--Event-----------------------|--timestamp--|----delta_t---\r\n");
+
+  for (uint32_t i = first; i != last + 1; i++)
+  {
+    e = &ring[i & TRIG_MASK];
+    DEBUG_PRINTF("%-30s:%9d us | +%9u us%s\r\n", e->name, (int)((int32_t)(e->time - t->time) / (int32_t)cyc_us),
+                 (unsigned)(e->delta / cyc_us), (i == trig_pos) ? " <- trigger" : "");
+  }
+  DEBUG_PRINTF("\r\n");
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  arm_head = head;
+  state = TRIG_ARMED;
+  if (!primask)
+    __enable_irq();
+}
+
+#endif // PROFILING_TRIGGER
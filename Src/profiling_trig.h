@@ -0,0 +1,41 @@
+#ifndef _PROFILING_TRIG_H
+#define _PROFILING_TRIG_H
+
+#include "profiling.h"
+
+/**
+ * Trigger capture.
+ * While armed every PROFILING_EVENT() is recorded in a ring, nothing is
+ * printed. A rule (event delta_t above threshold and/or predicate) or
+ * PROF_TRIG_Fire() freezes the ring after post more events, the capture
+ * of pre events before and post after the trigger is printed by the next
+ * PROFILING_STOP() or PROF_TRIG_Report() and the trigger is rearmed.
+ */
+#if PROFILING_TRIGGER
+
+// return nonzero to trigger, delta in cycles. Called from PROFILING_EVENT
+typedef uint8_t (*PROF_TRIG_Fn)(const char *event, uint32_t delta);
+
+void    PROF_TRIG_Rule(uint8_t rule, const char *event, uint32_t threshold_us, PROF_TRIG_Fn fn);
+void    PROF_TRIG_Arm(uint8_t pre, uint8_t post);
+void    PROF_TRIG_Disarm(void);
+void    PROF_TRIG_Fire(const char *reason);
+uint8_t PROF_TRIG_Armed(void);
+void    PROF_TRIG_Start(uint32_t now);
+void    PROF_TRIG_Event(const char *event, uint32_t now);
+void    PROF_TRIG_Report(void);
+
+#else
+
+#define PROF_TRIG_Rule(r, e, t, f)  ((void)0)
+#define PROF_TRIG_Arm(pre, post)    ((void)0)
+#define PROF_TRIG_Disarm()          ((void)0)
+#define PROF_TRIG_Fire(reason)      ((void)0)
+#define PROF_TRIG_Armed()           (0)
+#define PROF_TRIG_Start(now)        ((void)0)
+#define PROF_TRIG_Event(e, now)     ((void)0)
+#define PROF_TRIG_Report()          ((void)0)
+
+#endif // PROFILING_TRIGGER
+
+#endif // _PROFILING_TRIG_H
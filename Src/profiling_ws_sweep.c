@@ -0,0 +1,354 @@
+/***********************************************************************
+ File Name    : 'profiling_ws_sweep.c'
+ Title        : PROFILER
+ Description  : Flash wait state / prefetch / half cycle access sweep.
+                Workloads are timed with PROF_BENCH_Measure() for every
+                SYSCLK of ws_mhz[] and every legal flash configuration:
+                latency 0 WS up to 24 MHz, 1 WS up to 48 MHz, 2 WS up to
+                72 MHz (RM0316), more wait states always allowed,
+                prefetch on and off, half cycle access only with HSI as
+                SYSCLK and 0 WS.
+                SWO baud rate depends on core clock, so nothing is
+                printed until the original clock is restored.
+                MIPS is effective: MHz * best cycles / cycles, best
+                cycles of the workload are zero wait state execution.
+                "<-" marks the fastest configuration of each SYSCLK.
+
+                Examle output:
+                Flash sweep "branchy", best 845.06 cycles/iter:
+                --SYSCLK--|-WS-|-PF-|-HC-|---cycles-|---MIPS-
+                    8 MHz |  0 |  0 |  0 |   845.06 |   8.00 <-
+                    8 MHz |  0 |  0 |  1 |   845.06 |   8.00
+                   24 MHz |  0 |  1 |  0 |   845.06 |  24.00 <-
+                   48 MHz |  1 |  1 |  0 |   902.44 |  44.95 <-
+                   72 MHz |  2 |  0 |  0 |  1410.73 |  43.13
+                   72 MHz |  2 |  1 |  0 |   991.87 |  61.34 <-
+
+ Target MCU   : STM32F30x
+ Compiler     : ARM Compiler v5.04 for uVision armcc
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_ws_sweep.h"
+
+#if PROFILING_WS_SWEEP && PROFILING_BENCH
+
+/* Private Definitions -----------------------------------------------*/
+#define DEBUG_PRINTF printf
+#define WS_NOINLINE  __attribute__((noinline))
+#define WS_CONFIGS   20   // 8 + 6 + 4 + 2 legal configurations of ws_mhz[]
+#define WS_BUILTIN   4
+#define WS_LOADS     (WS_BUILTIN + PROFILING_BENCH_MAX)
+
+typedef struct
+{
+  uint8_t mhz;
+  uint8_t latency;
+  uint8_t prefetch;
+  uint8_t half;
+} ws_config_t;
+
+typedef struct
+{
+  const char    *name;
+  PROF_BENCH_Fn fn;
+  void          *arg;
+} ws_load_t;
+
+/* Private function prototypes ---------------------------------------*/
+static void ws_linear(void *arg);
+static void ws_branchy(void *arg);
+static void ws_flash_read(void *arg);
+static void ws_calls(void *arg);
+static uint32_t ws_leaf_add(uint32_t x);
+static uint32_t ws_leaf_rot(uint32_t x);
+static int  ws_clock(uint8_t mhz);
+static void ws_restore(uint32_t cfgr, uint32_t acr);
+static int  ws_configs(void);
+
+/* Private variables -------------------------------------------------*/
+static const uint8_t ws_mhz[] = { 8, 24, 48, 72 };
+
+#define WS_T4(x)   (x) * 0x9E3779B1u, ((x) + 1) * 0x9E3779B1u, ((x) + 2) * 0x9E3779B1u, ((x) + 3) * 0x9E3779B1u
+#define WS_T16(x)  WS_T4(x), WS_T4((x) + 4), WS_T4((x) + 8), WS_T4((x) + 12)
+static const uint32_t ws_table[64] = { WS_T16(0), WS_T16(16), WS_T16(32), WS_T16(48) };
+
+static uint32_t (* const ws_leaf[2])(uint32_t) = { ws_leaf_add, ws_leaf_rot };
+
+static uint32_t    ws_data[64];
+static volatile uint32_t ws_sink;
+static ws_config_t config[WS_CONFIGS];
+static ws_load_t   load[WS_LOADS];
+static float       cycles[WS_CONFIGS][WS_LOADS];  // < 0 - clock not reachable
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Straight line ALU code, sequential fetch
+ */
+WS_NOINLINE static void ws_linear(void *arg)
+{
+  uint32_t *d = arg;
+  uint32_t a = d[0], b = d[1], c = d[2], e = d[3];
+
+#define WS_MIX  a += b; b ^= c; c = (c << 7) | (c >> 25); e += a ^ c;
+  WS_MIX WS_MIX WS_MIX WS_MIX WS_MIX WS_MIX WS_MIX WS_MIX
+  WS_MIX WS_MIX WS_MIX WS_MIX WS_MIX WS_MIX WS_MIX WS_MIX
+#undef WS_MIX
+
+  d[0] = a; d[1] = b; d[2] = c; d[3] = e;
+}
+
+
+/**
+ * @brief Data dependent branches, prefetch queue flushes
+ */
+WS_NOINLINE static void ws_branchy(void *arg)
+{
+  const uint8_t *p = arg;
+  uint32_t s = 0;
+
+  for (int i = 0; i < 64; i++)
+  {
+    switch (p[i] & 3)
+    {
+      case 0:  s += p[i]; break;
+      case 1:  s ^= i; break;
+      case 2:  s <<= 1; break;
+      default: s--; break;
+    }
+  }
+  ws_sink = s;
+}
+
+
+/**
+ * @brief Constant table reads, data fetch from flash competes with code
+ */
+WS_NOINLINE static void ws_flash_read(void *arg)
+{
+  const uint32_t *t = arg;
+  uint32_t s = 0;
+
+  for (int i = 0; i < 64; i += 4)
+    s += t[i] ^ t[i + 1] ^ t[i + 2] ^ t[i + 3];
+  ws_sink = s;
+}
+
+
+WS_NOINLINE static uint32_t ws_leaf_add(uint32_t x) { return x + 0x1234; }
+WS_NOINLINE static uint32_t ws_leaf_rot(uint32_t x) { return (x << 3) | (x >> 29); }
+
+
+/**
+ * @brief Indirect calls and returns, fetch from non-sequential addresses
+ */
+WS_NOINLINE static void ws_calls(void *arg)
+{
+  const uint32_t *d = arg;
+  uint32_t s = 0;
+
+  for (int i = 0; i < 16; i++)
+    s = ws_leaf[d[i] & 1](s);
+  ws_sink = s;
+}
+
+
+/**
+ * @brief Switch SYSCLK, HSI for 8 MHz, PLL from HSE/PREDIV or HSI/2 else
+ *
+ * @return 0 - clock not reachable with PLL multiplier 2..16
+ */
+static int ws_clock(uint8_t mhz)
+{
+  uint32_t hz = mhz * 1000000u;
+  uint32_t pll_in, pll_src, mul;
+
+  // 2 WS and no half cycle access are safe for any SYSCLK during switch
+  FLASH_HalfCycleAccessCmd(DISABLE);
+  FLASH_SetLatency(FLASH_Latency_2);
+  RCC_SYSCLKConfig(RCC_SYSCLKSource_HSI);
+  while (RCC_GetSYSCLKSource() != RCC_CFGR_SWS_HSI);
+  RCC_PLLCmd(DISABLE);
+
+  if (hz != HSI_VALUE)
+  {
+    if (RCC_GetFlagStatus(RCC_FLAG_HSERDY) != RESET)
+    {
+      pll_in = HSE_VALUE / ((RCC->CFGR2 & RCC_CFGR2_PREDIV1) + 1);
+      pll_src = RCC_PLLSource_PREDIV1;
+    }
+    else
+    {
+      pll_in = HSI_VALUE / 2;
+      pll_src = RCC_PLLSource_HSI_Div2;
+    }
+    mul = hz / pll_in;
+    if (mul < 2 || mul > 16 || mul * pll_in != hz)
+      return 0;
+
+    RCC_PLLConfig(pll_src, (mul - 2) << 18);  // RCC_PLLMul_x
+    RCC_PLLCmd(ENABLE);
+    while (RCC_GetFlagStatus(RCC_FLAG_PLLRDY) == RESET);
+    RCC_SYSCLKConfig(RCC_SYSCLKSource_PLLCLK);
+    while (RCC_GetSYSCLKSource() != RCC_CFGR_SWS_PLL);
+  }
+
+  SystemCoreClockUpdate();
+  return 1;
+}
+
+
+/**
+ * @brief Back to SYSCLK source, PLL and flash settings before sweep
+ */
+static void ws_restore(uint32_t cfgr, uint32_t acr)
+{
+  FLASH_HalfCycleAccessCmd(DISABLE);
+  FLASH_SetLatency(FLASH_Latency_2);
+  RCC_SYSCLKConfig(RCC_SYSCLKSource_HSI);
+  while (RCC_GetSYSCLKSource() != RCC_CFGR_SWS_HSI);
+  RCC_PLLCmd(DISABLE);
+  RCC_PLLConfig(cfgr & RCC_CFGR_PLLSRC, cfgr & RCC_CFGR_PLLMULL);
+
+  if ((cfgr & RCC_CFGR_SWS) == RCC_CFGR_SWS_PLL)
+  {
+    RCC_PLLCmd(ENABLE);
+    while (RCC_GetFlagStatus(RCC_FLAG_PLLRDY) == RESET);
+  }
+  RCC_SYSCLKConfig(cfgr & RCC_CFGR_SW);
+  while (RCC_GetSYSCLKSource() != (cfgr & RCC_CFGR_SWS));
+
+  FLASH->ACR = acr & (FLASH_ACR_LATENCY | FLASH_ACR_HLFCYA | FLASH_ACR_PRFTBE);
+  SystemCoreClockUpdate();
+}
+
+
+/**
+ * @brief Legal configurations of ws_mhz[]
+ *
+ * @return Number of configurations
+ */
+static int ws_configs(void)
+{
+  int n = 0;
+
+  for (int c = 0; c < (int)sizeof(ws_mhz); c++)
+  {
+    uint8_t mhz = ws_mhz[c];
+    uint8_t ws_min = (mhz <= 24) ? 0 : (mhz <= 48) ? 1 : 2;
+
+    for (uint8_t ws = ws_min; ws <= 2; ws++)
+    {
+      for (uint8_t half = 0; half <= (ws == 0 && mhz * 1000000u == HSI_VALUE); half++)
+      {
+        for (uint8_t pf = 0; pf <= 1 && n < WS_CONFIGS; pf++)
+        {
+          config[n].mhz = mhz;
+          config[n].latency = ws;
+          config[n].prefetch = pf;
+          config[n].half = half;
+          n++;
+        }
+      }
+    }
+  }
+  return n;
+}
+
+
+/**
+ * @brief Run sweep, print one table per workload to ITM Stimulus Port 0.
+ *        Takes ~1 s per workload and configuration
+ */
+void PROF_WS_SWEEP_Run(void)
+{
+  uint32_t cfgr = RCC->CFGR;
+  uint32_t acr = FLASH->ACR;
+  uint32_t seed = 1;
+  PROF_BENCH_Result_t r;
+  uint8_t mhz = 0;
+  int configs, loads;
+  int c, l;
+
+  for (l = 0; l < 64; l++)
+  {
+    seed = seed * 1664525 + 1013904223;
+    ws_data[l] = seed;
+  }
+
+  load[0].name = "linear";      load[0].fn = ws_linear;     load[0].arg = ws_data;
+  load[1].name = "branchy";     load[1].fn = ws_branchy;    load[1].arg = ws_data;
+  load[2].name = "flash read";  load[2].fn = ws_flash_read; load[2].arg = (void *)ws_table;
+  load[3].name = "calls";       load[3].fn = ws_calls;      load[3].arg = ws_data;
+  for (loads = WS_BUILTIN; loads < WS_LOADS; loads++)
+  {
+    load[loads].name = PROF_BENCH_Get(loads - WS_BUILTIN, &load[loads].fn, &load[loads].arg);
+    if (load[loads].name == NULL)
+      break;
+  }
+
+  configs = ws_configs();
+  for (c = 0; c < configs; c++)
+  {
+    for (l = 0; l < loads; l++)
+      cycles[c][l] = -1;
+
+    if (config[c].mhz != mhz)
+    {
+      mhz = 0;
+      if (!ws_clock(config[c].mhz))
+        continue;
+      mhz = config[c].mhz;
+    }
+    FLASH_SetLatency(config[c].latency);  // FLASH_Latency_x
+    FLASH_PrefetchBufferCmd(config[c].prefetch ? ENABLE : DISABLE);
+    FLASH_HalfCycleAccessCmd(config[c].half ? ENABLE : DISABLE);
+
+    for (l = 0; l < loads; l++)
+    {
+      PROF_BENCH_Measure(load[l].fn, load[l].arg, PROF_BENCH_NOIRQ, &r);
+      cycles[c][l] = r.cycles;
+    }
+  }
+  ws_restore(cfgr, acr);
+
+  for (l = 0; l < loads; l++)
+  {
+    float best = 0;
+
+    for (c = 0; c < configs; c++)
+    {
+      if (cycles[c][l] > 0 && (best == 0 || cycles[c][l] < best))
+        best = cycles[c][l];
+    }
+
+    DEBUG_PRINTF("Flash sweep \"%s\", best %.2f cycles/iter:\r\n"
+                 "--SYSCLK--|-WS-|-PF-|-HC-|---cycles-|---MIPS-\r\n", load[l].name, best);
+    for (c = 0; c < configs; c++)
+    {
+      float mips = (cycles[c][l] > 0) ? config[c].mhz * best / cycles[c][l] : 0;
+      int fastest = (mips > 0);
+
+      // fastest configuration of this SYSCLK
+      for (int o = 0; o < configs && fastest; o++)
+      {
+        if (config[o].mhz == config[c].mhz && cycles[o][l] > 0 && cycles[o][l] < cycles[c][l])
+          fastest = 0;
+        if (o < c && config[o].mhz == config[c].mhz && cycles[o][l] == cycles[c][l])
+          fastest = 0;
+      }
+
+      DEBUG_PRINTF("  %3u MHz |  %u |  %u |  %u ",
+                   config[c].mhz, config[c].latency, config[c].prefetch, config[c].half);
+      if (cycles[c][l] < 0)
+        DEBUG_PRINTF("|        - |      -\r\n");
+      else
+        DEBUG_PRINTF("|%9.2f |%7.2f%s\r\n", cycles[c][l], mips, fastest ? " <-" : "");
+    }
+    DEBUG_PRINTF("\r\n");
+  }
+}
+
+#endif // PROFILING_WS_SWEEP
@@ -0,0 +1,23 @@
+#ifndef _PROFILING_WS_SWEEP_H
+#define _PROFILING_WS_SWEEP_H
+
+#include "profiling_bench.h"
+
+/**
+ * Flash wait state, prefetch and half cycle access sweep.
+ * Built-in workloads and benchmarks registered by PROF_BENCH_Add() are
+ * measured at 8 (HSI), 24, 48 and 72 MHz SYSCLK with every legal
+ * flash configuration. Clock and flash settings are restored before
+ * the report is printed. Needs PROFILING_BENCH.
+ */
+#if PROFILING_WS_SWEEP && PROFILING_BENCH
+
+void PROF_WS_SWEEP_Run(void);
+
+#else
+
+#define PROF_WS_SWEEP_Run() ((void)0)
+
+#endif // PROFILING_WS_SWEEP
+
+#endif // _PROFILING_WS_SWEEP_H
@@ -40,6 +40,7 @@ Stack_Size      EQU     0x00000400
                 AREA    STACK, NOINIT, READWRITE, ALIGN=3
 Stack_Mem       SPACE   Stack_Size
 __initial_sp
+                EXPORT  Stack_Mem                  ; stack bottom for profiler stack watermark
 
 
 ; <h> Heap Configuration
@@ -175,9 +176,13 @@ Reset_Handler    PROC
                  EXPORT  Reset_Handler             [WEAK]
         IMPORT  SystemInit
         IMPORT  __main
+        IMPORT  PROF_BOOT_Reset           [WEAK] ; profiling_boot.c, BL replaced by NOP
+        IMPORT  PROF_BOOT_SystemInit      [WEAK] ; when PROFILING_BOOT is off
 
+                 BL      PROF_BOOT_Reset
                  LDR     R0, =SystemInit
                  BLX     R0
+                 BL      PROF_BOOT_SystemInit
                  LDR     R0, =__main
                  BX      R0
                  ENDP
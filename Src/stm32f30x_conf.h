@@ -34,13 +34,13 @@
 /* Comment the line below to disable peripheral header file inclusion */
 //#include "stm32f30x_adc.h"
 //#include "stm32f30x_can.h"
-//#include "stm32f30x_crc.h"
+#include "stm32f30x_crc.h"
 //#include "stm32f30x_comp.h"
 //#include "stm32f30x_dac.h"
 //#include "stm32f30x_dbgmcu.h"
-//#include "stm32f30x_dma.h"
+#include "stm32f30x_dma.h"
 //#include "stm32f30x_exti.h"
-//#include "stm32f30x_flash.h"
+#include "stm32f30x_flash.h"
 //#include "stm32f30x_fmc.h"
 #include "stm32f30x_gpio.h"
 //#include "stm32f30x_hrtim.h"
@@ -48,9 +48,9 @@
 //#include "stm32f30x_i2c.h"
 //#include "stm32f30x_iwdg.h"
 //#include "stm32f30x_opamp.h"
-//#include "stm32f30x_pwr.h"
+#include "stm32f30x_pwr.h"
 #include "stm32f30x_rcc.h"
-//#include "stm32f30x_rtc.h"
+#include "stm32f30x_rtc.h"
 //#include "stm32f30x_spi.h"
 #include "stm32f30x_tim.h"
 //#include "stm32f30x_usart.h"
@@ -30,6 +30,9 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32f30x.h"
 #include "stm32f30x_it.h"
+#include "profiling_load.h"
+#include "profiling_rtc.h"
+#include "profiling_delay.h"
 
 __IO int32_t Tick;
 
@@ -57,6 +60,9 @@ void NMI_Handler(void)
 {
 }
 
+#if !PROFILING_FAULT_DUMP
+/* With PROFILING_FAULT_DUMP fault handlers are in profiling_fault.c */
+
 /**
   * @brief  This function handles Hard Fault exception.
   * @param  None
@@ -108,6 +114,7 @@ void UsageFault_Handler(void)
   {
   }
 }
+#endif /* PROFILING_FAULT_DUMP */
 
 /**
   * @brief  This function handles SVCall exception.
@@ -143,7 +150,12 @@ void PendSV_Handler(void)
   */
 void SysTick_Handler(void)
 {
+  PROF_DELAY_Tick();
+#if !PROFILING_TICKLESS
   Tick++;
+  PROF_LOAD_Tick();
+  PROF_RTC_Tick();
+#endif
 }
 
 /******************************************************************************/
@@ -100,6 +100,7 @@
   */
 
 #include "stm32f30x.h"
+#include "profiling_clock.h"
 
 /**
   * @}
@@ -236,6 +237,9 @@ void SystemInit(void)
 void SystemCoreClockUpdate (void)
 {
   uint32_t tmp = 0, pllmull = 0, pllsource = 0, prediv1factor = 0;
+#if PROFILING_CLOCK_EPOCHS
+  uint32_t hz_old = SystemCoreClock;
+#endif
 
   /* Get SYSCLK source -------------------------------------------------------*/
   tmp = RCC->CFGR & RCC_CFGR_SWS;
@@ -275,6 +279,9 @@ void SystemCoreClockUpdate (void)
   tmp = AHBPrescTable[((RCC->CFGR & RCC_CFGR_HPRE) >> 4)];
   /* HCLK clock frequency */
   SystemCoreClock >>= tmp;  
+
+  /* Profiler time conversion uses new frequency from now on */
+  PROF_CLOCK_Notify(hz_old, SystemCoreClock);
 }
 
 /**
@@ -0,0 +1,47 @@
+/***********************************************************************
+ File Name    : 'test.h'
+ Title        : PROFILER
+ Description  : Checks of host tests. Failed check is printed with
+                file and line, TEST_END() returns number of failures
+                as exit code for ctest.
+ Target MCU   : Host (Linux, gcc/clang)
+ Editor Tabs  : 2
+***********************************************************************/
+
+#ifndef _TEST_H
+#define _TEST_H
+
+#include "stm32f30x.h"
+
+static int test_failed;
+
+#define CHECK(cond) \
+  do { if (!(cond)) { test_failed++; printf("%s:%d: CHECK(%s) failed\r\n", __FILE__, __LINE__, #cond); } } while (0)
+
+#define CHECK_EQ(a, b) \
+  do { long long _a = (long long)(a), _b = (long long)(b); \
+       if (_a != _b) { test_failed++; printf("%s:%d: %s == %s failed: %lld != %lld\r\n", \
+                                             __FILE__, __LINE__, #a, #b, _a, _b); } } while (0)
+
+#define TEST_END() \
+  (printf("%s: %s\r\n", __FILE__, test_failed ? "FAILED" : "passed"), test_failed)
+
+/**
+ * @brief Stop host clock at cycle, DWT->CYCCNT changes only by test
+ */
+__STATIC_INLINE void test_clock(uint32_t cycle)
+{
+  HOST_dwt_manual = 1;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  DWT->CYCCNT = cycle;
+}
+
+/**
+ * @brief Advance stopped host clock
+ */
+__STATIC_INLINE void test_step(uint32_t cycles)
+{
+  DWT->CYCCNT += cycles;
+}
+
+#endif // _TEST_H
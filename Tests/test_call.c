@@ -0,0 +1,192 @@
+/***********************************************************************
+ File Name    : 'test_call.c'
+ Title        : PROFILER
+ Description  : Host test of call graph profiler (profiling_call.c,
+                PROFILING_CALL_GRAPH): hooks driven through a known call
+                tree with exact cycle steps and a nested interrupt,
+                inclusive and exclusive times and caller->callee edges
+                checked. More exits than PROFILING_CALL_RING, so batch
+                table updates are included.
+ Target MCU   : Host (Linux, gcc/clang)
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_call.h"
+#include "test.h"
+
+/* Private Definitions -----------------------------------------------*/
+#define FN_A    0x08000101u
+#define FN_B    0x08000201u
+#define FN_C    0x08000301u
+#define FN_D    0x08000401u
+#define FN_I    0x08000501u   // interrupt handler
+#define FN_J    0x08000601u   // called by interrupt handler
+#define IRQ_I   (16 + 28)     // IPSR of FN_I, TIM2
+
+void __cyg_profile_func_enter(void *fn, void *site);
+void __cyg_profile_func_exit(void *fn, void *site);
+
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Hook call at cycle t of test clock
+ */
+static void enter(uint32_t fn, uint32_t t)
+{
+  DWT->CYCCNT = t;
+  __cyg_profile_func_enter((void *)(uintptr_t)fn, NULL);
+}
+
+static void leave(uint32_t fn, uint32_t t)
+{
+  DWT->CYCCNT = t;
+  __cyg_profile_func_exit((void *)(uintptr_t)fn, NULL);
+}
+
+
+/**
+ * @brief Check calls, exclusive and inclusive cycles of function
+ */
+static void check_func(uint32_t fn, uint32_t calls, uint32_t excl, uint32_t incl)
+{
+  PROF_CALL_Stat_t stat;
+
+  CHECK(PROF_CALL_Func(fn, &stat));
+  CHECK_EQ(stat.calls, calls);
+  CHECK_EQ(stat.excl, excl);
+  CHECK_EQ(stat.incl, incl);
+}
+
+
+/**
+ * @brief A calls B (calls C), C, B (calls D, interrupted by I calling J)
+ */
+static void test_tree(void)
+{
+  test_clock(0);
+  PROF_CALL_Reset();
+
+  enter(FN_A, 0);
+  enter(FN_B, 100);
+  enter(FN_C, 150);
+  leave(FN_C, 250);
+  leave(FN_B, 400);
+  enter(FN_C, 500);
+  leave(FN_C, 550);
+  enter(FN_B, 600);
+  enter(FN_D, 610);
+  HOST_ipsr = IRQ_I;   // interrupt nests on the same stack
+  enter(FN_I, 620);
+  enter(FN_J, 640);
+  leave(FN_J, 660);
+  leave(FN_I, 700);
+  HOST_ipsr = 0;
+  leave(FN_D, 710);
+  leave(FN_B, 800);
+  leave(FN_A, 1000);
+
+  // interrupt time is in no frame of A, B, D
+  check_func(FN_A, 1, 1000 - 80 - 300 - 50 - 120, 1000 - 80);
+  check_func(FN_B, 2, 200 + 100, 300 + 120);
+  check_func(FN_C, 2, 100 + 50, 100 + 50);
+  check_func(FN_D, 1, 20, 20);
+  check_func(FN_I, 1, 80 - 20, 80);
+  check_func(FN_J, 1, 20, 20);
+
+  CHECK_EQ(PROF_CALL_Edge(0, FN_A), 1);
+  CHECK_EQ(PROF_CALL_Edge(FN_A, FN_B), 2);
+  CHECK_EQ(PROF_CALL_Edge(FN_A, FN_C), 1);
+  CHECK_EQ(PROF_CALL_Edge(FN_B, FN_C), 1);
+  CHECK_EQ(PROF_CALL_Edge(FN_B, FN_D), 1);
+  CHECK_EQ(PROF_CALL_Edge(0, FN_I), 1);
+  CHECK_EQ(PROF_CALL_Edge(FN_I, FN_J), 1);
+  CHECK_EQ(PROF_CALL_Edge(FN_D, FN_I), 0);
+  CHECK_EQ(PROF_CALL_Edge(FN_B, FN_A), 0);
+  CHECK_EQ(PROF_CALL_Edge(FN_C, FN_D), 0);
+
+  PROF_CALL_Report();
+}
+
+
+/**
+ * @brief Many calls over CYCCNT wrap, records added in batches
+ */
+static void test_loop(void)
+{
+  const uint32_t n = 10 * PROFILING_CALL_RING + 3;
+  uint32_t t = 0xFFFFF000;
+
+  test_clock(t);
+  PROF_CALL_Reset();
+
+  enter(FN_A, t);
+  for (uint32_t i = 0; i < n; i++)
+  {
+    enter(FN_B, t += 10);
+    enter(FN_C, t += 5);
+    leave(FN_C, t += 20);
+    leave(FN_B, t += 5);
+  }
+  leave(FN_A, t += 10);
+
+  check_func(FN_A, 1, 10 * n + 10, 40 * n + 10);
+  check_func(FN_B, n, 10 * n, 30 * n);
+  check_func(FN_C, n, 20 * n, 20 * n);
+  CHECK_EQ(PROF_CALL_Edge(FN_A, FN_B), n);
+  CHECK_EQ(PROF_CALL_Edge(FN_B, FN_C), n);
+
+  // reset clears tables
+  PROF_CALL_Reset();
+  CHECK_EQ(PROF_CALL_Edge(FN_A, FN_B), 0);
+}
+
+
+/**
+ * @brief Exit without entry after reset is ignored
+ */
+static void test_unbalanced(void)
+{
+  PROF_CALL_Stat_t stat;
+
+  test_clock(0);
+  PROF_CALL_Reset();
+  leave(FN_A, 100);
+  CHECK(!PROF_CALL_Func(FN_A, &stat));
+
+  enter(FN_B, 200);
+  leave(FN_B, 300);
+  check_func(FN_B, 1, 100, 100);
+}
+
+
+/**
+ * @brief Reset with frame open (PROFILING_START inside function), hook
+ *        cost measurement on running clock is not a callee of the frame
+ */
+static void test_open_reset(void)
+{
+  PROF_CALL_Stat_t stat;
+
+  HOST_dwt_manual = 0;
+  __cyg_profile_func_enter((void *)(uintptr_t)FN_A, NULL);
+  PROF_CALL_Reset();
+  __cyg_profile_func_exit((void *)(uintptr_t)FN_A, NULL);
+
+  CHECK(PROF_CALL_Func(FN_A, &stat));
+  CHECK_EQ(stat.calls, 1);
+  CHECK_EQ(stat.excl, stat.incl);
+  CHECK_EQ(PROF_CALL_Edge(0, FN_A), 1);
+  CHECK_EQ(PROF_CALL_Edge(FN_A, (uint32_t)(uintptr_t)PROF_CALL_Reset), 0);
+}
+
+
+int main(void)
+{
+  test_tree();
+  test_loop();
+  test_unbalanced();
+  test_open_reset();
+  return TEST_END();
+}
@@ -0,0 +1,155 @@
+/***********************************************************************
+ File Name    : 'test_clock.c'
+ Title        : PROFILER
+ Description  : Host test of clock change aware time conversion
+                (profiling_clock.c, PROFILING_CLOCK_EPOCHS): intervals
+                over several clock changes and over CYCCNT wrap.
+ Target MCU   : Host (Linux, gcc/clang)
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_clock.h"
+#include "test.h"
+
+/* Private Definitions -----------------------------------------------*/
+#define MHZ   1000000u
+
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Single frequency, no or no relevant change
+ */
+static void test_no_change(void)
+{
+  const PROF_CLOCK_Epoch_t e[1] = {{ 1000000, 72 * MHZ, 8 * MHZ }};
+
+  CHECK_EQ(PROF_CLOCK_Convert(NULL, 0, 72 * MHZ, 0, 72000), 1000);
+  CHECK_EQ(PROF_CLOCK_Convert(NULL, 0, 8 * MHZ, 100, 100 + 8000), 1000);
+  // interval before first change runs at its old frequency
+  CHECK_EQ(PROF_CLOCK_Convert(e, 1, 8 * MHZ, 0, 72000), 1000);
+  // interval after last change at its new frequency
+  CHECK_EQ(PROF_CLOCK_Convert(e, 1, 72 * MHZ, 1000000, 1000000 + 8000), 1000);
+  // change exactly at t1 is not inside
+  CHECK_EQ(PROF_CLOCK_Convert(e, 1, 8 * MHZ, 1000000 - 72000, 1000000), 1000);
+}
+
+
+/**
+ * @brief Interval split at every change inside it
+ */
+static void test_multi_epoch(void)
+{
+  // 72 MHz .. 72000: 8 MHz .. 80000: 72 MHz .. 152000: 36 MHz
+  const PROF_CLOCK_Epoch_t e[3] =
+  {
+    {  72000, 72 * MHZ,  8 * MHZ },
+    {  80000,  8 * MHZ, 72 * MHZ },
+    { 152000, 72 * MHZ, 36 * MHZ },
+  };
+
+  CHECK_EQ(PROF_CLOCK_Convert(e, 3, 36 * MHZ, 0, 80000 + 72000), 3000);
+  CHECK_EQ(PROF_CLOCK_Convert(e, 3, 36 * MHZ, 0, 152000 + 36000), 4000);
+  // start inside 8 MHz epoch
+  CHECK_EQ(PROF_CLOCK_Convert(e, 3, 36 * MHZ, 76000, 80000 + 36000), 1000);
+  // start exactly at change uses new frequency
+  CHECK_EQ(PROF_CLOCK_Convert(e, 3, 36 * MHZ, 72000, 80000), 1000);
+  // inside one epoch
+  CHECK_EQ(PROF_CLOCK_Convert(e, 3, 36 * MHZ, 73000, 77000), 500);
+  CHECK_EQ(PROF_CLOCK_Convert(e, 3, 36 * MHZ, 0, 0), 0);
+}
+
+
+/**
+ * @brief Changes and interval over CYCCNT wrap
+ */
+static void test_wrap(void)
+{
+  const PROF_CLOCK_Epoch_t e[2] =
+  {
+    { 0xFFFFF000, 8 * MHZ, 72 * MHZ },
+    { 0x00011000, 72 * MHZ, 8 * MHZ },  // after wrap
+  };
+
+  // 0xFFFFF000 .. 0x00011000 at 72 MHz: 0x12000 = 73728 cycles = 1024 us
+  CHECK_EQ(PROF_CLOCK_Convert(e, 2, 8 * MHZ, 0xFFFFF000, 0x00011000), 1024);
+  // 4096 cycles at 8 MHz before, 8000 after
+  CHECK_EQ(PROF_CLOCK_Convert(e, 2, 8 * MHZ, 0xFFFFE000, 0x00011000 + 8000), 512 + 1024 + 1000);
+  // start after wrap
+  CHECK_EQ(PROF_CLOCK_Convert(e, 2, 8 * MHZ, 0x00001000, 0x00011000), 910);
+}
+
+
+/**
+ * @brief Clock switch like SystemCoreClockUpdate(): SystemCoreClock is
+ *        already new when notified
+ */
+static void clock_switch(uint32_t hz)
+{
+  uint32_t hz_old = SystemCoreClock;
+
+  SystemCoreClock = hz;
+  PROF_CLOCK_Notify(hz_old, SystemCoreClock);
+}
+
+
+/**
+ * @brief First notify, no change recorded before
+ */
+static void test_first_notify(void)
+{
+  uint32_t t0;
+
+  SystemCoreClock = 72 * MHZ;
+  test_clock(0x80000000);
+  t0 = DWT->CYCCNT;
+  test_step(72000);
+  clock_switch(8 * MHZ);
+  test_step(8000);
+  CHECK_EQ(PROF_CLOCK_ToUs(t0, DWT->CYCCNT), 2000);
+}
+
+
+/**
+ * @brief PROF_CLOCK_Notify() ring and PROF_CLOCK_ToUs()
+ */
+static void test_notify(void)
+{
+  uint32_t t0;
+
+  test_clock(0xFFFF0000);
+  t0 = DWT->CYCCNT;
+  clock_switch(72 * MHZ);
+  test_step(72000);
+  clock_switch(8 * MHZ);
+  test_step(8000);
+  clock_switch(72 * MHZ);
+  test_step(72000);
+  CHECK_EQ(PROF_CLOCK_ToUs(t0, DWT->CYCCNT), 3000);
+
+  // same frequency is not a change
+  clock_switch(72 * MHZ);
+  CHECK_EQ(PROF_CLOCK_ToUs(t0, DWT->CYCCNT), 3000);
+
+  // ring keeps last PROFILING_CLOCK_EPOCHS changes
+  for (int i = 0; i < PROFILING_CLOCK_EPOCHS; i++)
+  {
+    t0 = DWT->CYCCNT;
+    clock_switch((i & 1) ? 72 * MHZ : 36 * MHZ);
+    test_step(SystemCoreClock / 1000);
+  }
+  CHECK_EQ(PROF_CLOCK_ToUs(t0, DWT->CYCCNT), 1000);
+  clock_switch(72 * MHZ);
+}
+
+
+int main(void)
+{
+  test_no_change();
+  test_multi_epoch();
+  test_wrap();
+  test_first_notify();
+  test_notify();
+  return TEST_END();
+}
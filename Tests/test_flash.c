@@ -0,0 +1,243 @@
+/***********************************************************************
+ File Name    : 'test_flash.c'
+ Title        : PROFILER
+ Description  : Host test of flash capture log (profiling_flash.c,
+                PROFILING_FLASH_LOG) on RAM flash simulator: page
+                rotation and wear, power fail in record and in page
+                header, current page recovery by magic and sequence.
+                One event capture is a 48 byte record, 42 per page.
+ Target MCU   : Host (Linux, gcc/clang)
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_flash.h"
+#include "profiling_flash_port.h"
+#include "test.h"
+
+/* Private Definitions -----------------------------------------------*/
+#define PAGES       PROFILING_FLASH_LOG_PAGES
+#define PAGE_WORDS  (PROF_FLASH_PAGE_SIZE / 4)
+#define PER_PAGE    ((PROF_FLASH_PAGE_SIZE - 8) / (2 + 24 + 20 + 2))
+#define MAGIC       0x4C50
+
+#define PAGE_MAGIC(p) ((uint16_t)HOST_flash[(p) * PAGE_WORDS])
+#define PAGE_SEQ(p)   (HOST_flash[(p) * PAGE_WORDS + 1])
+
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief One event session, written to flash
+ *
+ * @return PROF_FLASH_Flush() result
+ */
+static uint8_t capture(void)
+{
+  PROFILING_START("flash");
+  PROFILING_EVENT("event");
+  PROFILING_STOP();
+  return PROF_FLASH_Flush();
+}
+
+
+/**
+ * @brief Power restored, PROF_FLASH_Init() on boot
+ */
+static void reboot(void)
+{
+  HOST_flash_ops = -1;
+  PROF_FLASH_Init();
+}
+
+
+static uint32_t total_erases(void)
+{
+  uint32_t n = 0;
+
+  for (int p = 0; p < PAGES; p++)
+    n += HOST_flash_erases[p];
+  return n;
+}
+
+
+/**
+ * @brief Fill pages until one was just opened, then fill it
+ *
+ * @return Current (full) page
+ */
+static int fill_page(void)
+{
+  uint32_t erases = total_erases();
+  int page = -1;
+
+  while (total_erases() == erases)
+    CHECK(capture());
+  for (int p = 0; p < PAGES; p++)
+  {
+    if (PAGE_MAGIC(p) == MAGIC && (page < 0 || (int32_t)(PAGE_SEQ(p) - PAGE_SEQ(page)) > 0))
+      page = p;
+  }
+  for (int i = 1; i < PER_PAGE; i++)
+    CHECK(capture());
+  return page;
+}
+
+
+/**
+ * @brief Empty log on blank flash, pages used as ring, equal wear
+ */
+static void test_rotation(void)
+{
+  const int n = PER_PAGE * PAGES * 2 + 5;
+  uint32_t min = 0xFFFFFFFF, max = 0;
+
+  reboot();
+  CHECK_EQ(PAGE_MAGIC(0), MAGIC);
+  CHECK_EQ(PAGE_SEQ(0), 1);
+  CHECK_EQ(PROF_FLASH_Count(), 0);
+
+  for (int i = 0; i < n; i++)
+    CHECK(capture());
+
+  // oldest pages erased, current page 8 % PAGES with 5 captures
+  CHECK_EQ(PROF_FLASH_Count(), (PAGES - 1) * PER_PAGE + 5);
+  CHECK_EQ(PAGE_SEQ(0), 2 * PAGES + 1);
+  for (int p = 0; p < PAGES; p++)
+  {
+    CHECK_EQ(PAGE_MAGIC(p), MAGIC);
+    min = HOST_flash_erases[p] < min ? HOST_flash_erases[p] : min;
+    max = HOST_flash_erases[p] > max ? HOST_flash_erases[p] : max;
+  }
+  CHECK(max - min <= 1);
+
+  // log found again after reset, appended
+  reboot();
+  CHECK_EQ(PROF_FLASH_Count(), (PAGES - 1) * PER_PAGE + 5);
+  CHECK(capture());
+  CHECK_EQ(PROF_FLASH_Count(), (PAGES - 1) * PER_PAGE + 6);
+  CHECK_EQ(total_erases(), 2 * PAGES + 1);
+}
+
+
+/**
+ * @brief Power fail in payload and in commit of record
+ */
+static void test_torn_record(void)
+{
+  uint16_t count;
+
+  PROF_FLASH_Erase();
+  reboot();
+  CHECK(capture());
+  count = PROF_FLASH_Count();
+
+  // length, then 5th half word of payload
+  HOST_flash_ops = 6;
+  CHECK(!capture());
+  reboot();
+  CHECK_EQ(PROF_FLASH_Count(), count);
+  CHECK(capture());
+  CHECK_EQ(PROF_FLASH_Count(), count + 1);
+
+  // length, 22 payload half words, commit
+  HOST_flash_ops = 1 + 22 + 1;
+  CHECK(!capture());
+  reboot();
+  CHECK_EQ(PROF_FLASH_Count(), count + 1);
+  CHECK(capture());
+  CHECK_EQ(PROF_FLASH_Count(), count + 2);
+
+  // torn length half word is not programmed, same place reused
+  HOST_flash_ops = 1;
+  CHECK(!capture());
+  reboot();
+  CHECK(capture());
+  CHECK_EQ(PROF_FLASH_Count(), count + 3);
+}
+
+
+/**
+ * @brief Power fail while next page is opened: in erase, in header
+ */
+static void test_torn_header(void)
+{
+  // erase, sequence low, sequence high, magic
+  const int32_t fail[2] = { 1, 4 };
+  uint32_t seq;
+  uint16_t count;
+  int page, next;
+
+  PROF_FLASH_Erase();
+  reboot();
+
+  for (int f = 0; f < 2; f++)
+  {
+    page = fill_page();
+    next = (page + 1) % PAGES;
+    seq = PAGE_SEQ(page);
+    count = PROF_FLASH_Count();
+
+    HOST_flash_ops = fail[f];
+    CHECK(!capture());
+    CHECK(PAGE_MAGIC(next) != MAGIC);
+
+    // full page stays current, captures of erased page are gone
+    reboot();
+    CHECK(PROF_FLASH_Count() <= count);
+    count = PROF_FLASH_Count();
+    CHECK(capture());
+    CHECK_EQ(PAGE_MAGIC(next), MAGIC);
+    CHECK_EQ(PAGE_SEQ(next), seq + 1);
+    CHECK_EQ(PROF_FLASH_Count(), count + 1);
+  }
+}
+
+
+/**
+ * @brief Current page is highest sequence over wrap, pages without
+ *        magic are ignored whatever their sequence
+ */
+static void test_recovery(void)
+{
+  const uint32_t seq[PAGES] = { 0xFFFFFFFE, 0xFFFFFFFF, 0x00000000, 0x00000007 };
+
+  PROF_FLASH_Erase();
+  for (int p = 0; p < PAGES; p++)
+  {
+    HOST_flash[p * PAGE_WORDS] = (p == 3) ? 0xFFFF0000 : (0xFFFF0000 | MAGIC);
+    PAGE_SEQ(p) = seq[p];
+  }
+
+  reboot();
+  CHECK_EQ(PROF_FLASH_Count(), 0);
+  CHECK(capture());
+  CHECK_EQ(PROF_FLASH_Count(), 1);
+
+  // capture went to page 2, next page opened with sequence 1
+  for (int i = 1; i < PER_PAGE; i++)
+    CHECK(capture());
+  CHECK(PAGE_MAGIC(3) != MAGIC);
+  CHECK(capture());
+  CHECK_EQ(PAGE_MAGIC(3), MAGIC);
+  CHECK_EQ(PAGE_SEQ(3), 1);
+  CHECK_EQ(PROF_FLASH_Count(), PER_PAGE + 1);
+
+  // no valid page: log restarts on page 0
+  for (int p = 0; p < PAGES; p++)
+    HOST_flash[p * PAGE_WORDS] = 0;
+  reboot();
+  CHECK_EQ(PAGE_MAGIC(0), MAGIC);
+  CHECK_EQ(PAGE_SEQ(0), 1);
+  CHECK_EQ(PROF_FLASH_Count(), 0);
+}
+
+
+int main(void)
+{
+  test_rotation();
+  test_torn_record();
+  test_torn_header();
+  test_recovery();
+  return TEST_END();
+}
@@ -0,0 +1,93 @@
+/***********************************************************************
+ File Name    : 'test_hpp.cpp'
+ Title        : PROFILER
+ Description  : Host test of C++17 layer (profiling.hpp): compile time
+                event IDs, Session<N> times by index and by ID,
+                CSession, PoolSession and ScopedRegion on profiler_host.
+ Target MCU   : Host (Linux, gcc/clang), C++17
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling.hpp"
+#include "test.h"
+
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief IDs are compile time constants, usable as case labels
+ */
+static int id_switch(uint32_t id)
+{
+  switch (id)
+  {
+    case PROF_ID("a"): return 1;
+    case PROF_ID("b"): return 2;
+    default:           return 0;
+  }
+}
+
+
+/**
+ * @brief Event times by index and by ID, capacity limit
+ */
+static void test_session(void)
+{
+  static prof::Session<2> s("cpp");
+  static constexpr prof::EventId ev_c("c");
+
+  test_clock(0xFFFFFF00);
+  s.Start();
+  test_step(10);
+  PROF_EVENT(s, "a");
+  test_step(20);
+  PROF_EVENT(s, "b");
+  test_step(30);
+  s.Event(ev_c);            // over capacity, dropped
+
+  CHECK_EQ(s.Count(), 2);
+  CHECK_EQ(s.Id(0), PROF_ID("a"));
+  CHECK_EQ(id_switch(s.Id(1)), 2);
+  CHECK(s.Name(1)[0] == 'b');
+  CHECK_EQ(s.Time(0), 10);
+  CHECK_EQ(s.Time(1u), 30);
+  CHECK_EQ(s.TimeOf(PROF_ID("b")), 30);
+  CHECK_EQ(s.TimeOf(ev_c.id), 0);
+  s.Report();
+
+  s.Start();
+  CHECK_EQ(s.Count(), 0);
+}
+
+
+/**
+ * @brief Same interface on C API sessions, scoped start and stop
+ */
+static void test_c_sessions(void)
+{
+  prof::CSession c("c api");
+  prof::PoolSession p("pool");
+
+  test_clock(0);
+  {
+    prof::ScopedRegion<prof::CSession> region(c);
+    CHECK(PROFILING_IS_RUNNING());
+    PROF_EVENT(c, "a");
+  }
+  CHECK(!PROFILING_IS_RUNNING());
+
+  {
+    prof::ScopedRegion<prof::PoolSession> region(p);
+    test_step(100);
+    PROF_EVENT(p, "b");
+  }
+}
+
+
+int main(void)
+{
+  test_session();
+  test_c_sessions();
+  return TEST_END();
+}
@@ -0,0 +1,58 @@
+/***********************************************************************
+ File Name    : 'test_sample.c'
+ Title        : PROFILER
+ Description  : Host test of sampled events (profiling_sample.c,
+                PROFILING_SAMPLE): all occurrences are seen, only
+                events stored in the session table are recorded.
+ Target MCU   : Host (Linux, gcc/clang)
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling_sample.h"
+#include "test.h"
+
+/* Private variables -------------------------------------------------*/
+static PROF_SAMPLE_t site = { "site", 1, 1, 1 };   // every occurrence
+
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Occurrence of site, like PROFILING_EVENT_EVERY
+ */
+static void hit(int n)
+{
+  while (n--)
+  {
+    if (--site.countdown == 0)
+      PROF_SAMPLE_Hit(&site);
+  }
+}
+
+
+/**
+ * @brief Events without session and over full table are not recorded
+ */
+static void test_dropped(void)
+{
+  test_clock(0);
+
+  hit(3);
+  CHECK_EQ(site.seen, 3);
+  CHECK_EQ(site.recorded, 0);
+
+  PROFILING_START("sample");
+  CHECK_EQ(site.seen, 0);
+  hit(MAX_EVENT_COUNT + 5);
+  CHECK_EQ(site.seen, MAX_EVENT_COUNT + 5);
+  CHECK_EQ(site.recorded, MAX_EVENT_COUNT);
+  PROFILING_STOP();
+}
+
+
+int main(void)
+{
+  test_dropped();
+  return TEST_END();
+}
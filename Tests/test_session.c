@@ -0,0 +1,103 @@
+/***********************************************************************
+ File Name    : 'test_session.c'
+ Title        : PROFILER
+ Description  : Host test of profiler core (profiler_host library):
+                event times of PROFILING_START/EVENT/STOP session and
+                PROFILING_SESSION_START() handle pool.
+ Target MCU   : Host (Linux, gcc/clang)
+ Editor Tabs  : 2
+***********************************************************************/
+
+/* Includes ----------------------------------------------------------*/
+#include "profiling.h"
+#include "test.h"
+
+/* Private variables -------------------------------------------------*/
+static const char ev_a[] = "a";
+static const char ev_b[] = "b";
+
+/* -------------------------------------------------------------------*/
+
+
+/**
+ * @brief Event times are cycles from PROFILING_START
+ */
+static void test_events(void)
+{
+  const char *name;
+  const char *event[MAX_EVENT_COUNT];
+  uint32_t time[MAX_EVENT_COUNT];
+
+  CHECK(!PROFILING_IS_RUNNING());
+  test_clock(0xFFFFFF00);   // session over CYCCNT wrap
+  PROFILING_START("events");
+  CHECK(PROFILING_IS_RUNNING());
+  test_step(72);
+  PROFILING_EVENT(ev_a);
+  test_step(144);
+  PROFILING_EVENT(ev_b);
+
+  CHECK_EQ(PROFILING_GET_EVENTS(&name, time, event, MAX_EVENT_COUNT), 2);
+  CHECK(name && name[0] == 'e');
+  CHECK_EQ(time[0], 72);
+  CHECK_EQ(time[1], 216);
+  CHECK(event[0] == ev_a && event[1] == ev_b);
+
+  // last max events
+  CHECK_EQ(PROFILING_GET_EVENTS(&name, time, event, 1), 1);
+  CHECK(event[0] == ev_b);
+
+  PROFILING_STOP();
+  CHECK(!PROFILING_IS_RUNNING());
+  CHECK_EQ(PROFILING_GET_EVENTS(&name, time, event, MAX_EVENT_COUNT), 0);
+  CHECK(name == NULL);
+
+  // not recorded without session
+  PROFILING_EVENT(ev_a);
+  CHECK_EQ(PROFILING_GET_EVENTS(&name, time, event, MAX_EVENT_COUNT), 0);
+}
+
+
+/**
+ * @brief Handles from pool, NULL when exhausted, reused after stop
+ */
+static void test_pool(void)
+{
+  PROF_Session_t *s[PROFILING_SESSION_POOL];
+  PROF_Session_t *extra;
+  const char *name;
+  const char *event[MAX_EVENT_COUNT];
+  uint32_t time[MAX_EVENT_COUNT];
+
+  for (int i = 0; i < PROFILING_SESSION_POOL; i++)
+  {
+    s[i] = PROFILING_SESSION_START("pool");
+    CHECK(s[i] != NULL);
+    for (int j = 0; j < i; j++)
+      CHECK(s[i] != s[j]);
+  }
+  CHECK(PROFILING_SESSION_START("extra") == NULL);
+
+  // handle sessions do not start PROFILING_START session, but are running
+  CHECK(PROFILING_IS_RUNNING());
+  CHECK_EQ(PROFILING_GET_EVENTS(&name, time, event, MAX_EVENT_COUNT), 0);
+  PROFILING_SESSION_EVENT(s[0], ev_a);
+  PROFILING_SESSION_EVENT(NULL, ev_a);
+  PROFILING_SESSION_STOP(s[0]);
+  PROFILING_SESSION_STOP(NULL);
+
+  extra = PROFILING_SESSION_START("extra");
+  CHECK(extra == s[0]);
+  PROFILING_SESSION_STOP(extra);
+  for (int i = 1; i < PROFILING_SESSION_POOL; i++)
+    PROFILING_SESSION_STOP(s[i]);
+  CHECK(!PROFILING_IS_RUNNING());
+}
+
+
+int main(void)
+{
+  test_events();
+  test_pool();
+  return TEST_END();
+}
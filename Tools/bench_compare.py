@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+Collect and compare benchmark results printed by profiling_bench.c.
+
+usage:
+  bench_compare.py collect swo_log.txt -o armcc_O3.json [--label armcc -O3]
+  bench_compare.py compare base.json new.json [--threshold 2.0]
+  bench_compare.py show result.json
+
+collect reads the last BENCH-BEGIN..BENCH-END block of the SWO log.
+compare accepts .json files or SWO logs, prints cycles/iter of both runs
+and marks changes bigger than threshold percent and 3 standard deviations.
+"""
+
+import argparse
+import json
+import math
+import sys
+
+FORMAT = 1
+
+
+def parse_log(path):
+    run = last = None
+    with open(path, encoding="latin-1") as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith("BENCH-BEGIN,"):
+                fields = line.split(",", 3)
+                if int(fields[1]) != FORMAT:
+                    sys.exit("%s: unsupported BENCH format %s" % (path, fields[1]))
+                run = {"core_clock": int(fields[2]), "build": fields[3], "results": [], "complete": False}
+            elif line.startswith("BENCH,") and run is not None:
+                f = line.split(",")
+                # name may not contain commas, the rest is fixed
+                name = ",".join(f[1:-7])
+                run["results"].append({
+                    "name": name,
+                    "prefetch": int(f[-7]),
+                    "latency": int(f[-6]),
+                    "iters": int(f[-5]),
+                    "samples": int(f[-4]),
+                    "cycles": float(f[-3]),
+                    "stddev": float(f[-2]),
+                    "min": float(f[-1]),
+                })
+            elif line.startswith("BENCH-END") and run is not None:
+                run["complete"] = True
+                last = run
+    if last is not None:
+        return last
+    if run is None:
+        sys.exit("%s: no BENCH-BEGIN found" % path)
+    print("%s: BENCH-END missing, results incomplete" % path, file=sys.stderr)
+    return run
+
+
+def load(path):
+    if path.endswith(".json"):
+        with open(path) as f:
+            return json.load(f)
+    return parse_log(path)
+
+
+def key(r):
+    return (r["name"], r["prefetch"], r["latency"])
+
+
+def state(r):
+    return "%s/%dWS" % ("PF" if r["prefetch"] else "--", r["latency"])
+
+
+def cmd_collect(opt):
+    run = parse_log(opt.log)
+    if opt.label:
+        run["label"] = opt.label
+    with open(opt.output, "w") as f:
+        json.dump(run, f, indent=1)
+    print("%d results -> %s" % (len(run["results"]), opt.output))
+
+
+def cmd_show(opt):
+    run = load(opt.file)
+    print("%s, %s, %d Hz" % (run.get("label", opt.file), run["build"], run["core_clock"]))
+    print("%-30s %-7s %12s %10s %6s" % ("benchmark", "state", "cycles/iter", "stddev", "kept"))
+    for r in run["results"]:
+        print("%-30s %-7s %12.2f %10.2f %6d" % (r["name"], state(r), r["cycles"], r["stddev"], r["samples"]))
+
+
+def cmd_compare(opt):
+    base, new = load(opt.base), load(opt.new)
+    ref = {key(r): r for r in base["results"]}
+    print("base: %s (%s)" % (base.get("label", opt.base), base["build"]))
+    print("new : %s (%s)" % (new.get("label", opt.new), new["build"]))
+    print("%-30s %-7s %12s %12s %8s" % ("benchmark", "state", "base", "new", "change"))
+    changed = 0
+    for r in new["results"]:
+        b = ref.pop(key(r), None)
+        if b is None:
+            print("%-30s %-7s %12s %12.2f %8s" % (r["name"], state(r), "-", r["cycles"], "new"))
+            continue
+        delta = r["cycles"] - b["cycles"]
+        pct = 100.0 * delta / b["cycles"] if b["cycles"] else 0.0
+        noise = 3 * math.hypot(b["stddev"], r["stddev"])
+        mark = ""
+        if abs(pct) > opt.threshold and abs(delta) > noise:
+            mark = " <- slower" if delta > 0 else " <- faster"
+            changed += 1
+        print("%-30s %-7s %12.2f %12.2f %+7.1f%%%s" % (r["name"], state(r), b["cycles"], r["cycles"], pct, mark))
+    for b in ref.values():
+        print("%-30s %-7s %12.2f %12s %8s" % (b["name"], state(b), b["cycles"], "-", "removed"))
+    return 1 if changed and opt.fail else 0
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    sub = ap.add_subparsers(dest="cmd", required=True)
+
+    p = sub.add_parser("collect", help="SWO log -> json")
+    p.add_argument("log")
+    p.add_argument("-o", "--output", required=True)
+    p.add_argument("--label")
+
+    p = sub.add_parser("show", help="print results")
+    p.add_argument("file")
+
+    p = sub.add_parser("compare", help="compare two runs")
+    p.add_argument("base")
+    p.add_argument("new")
+    p.add_argument("--threshold", type=float, default=2.0, help="percent, default 2")
+    p.add_argument("--fail", action="store_true", help="exit code 1 if any benchmark changed")
+
+    opt = ap.parse_args()
+    sys.exit({"collect": cmd_collect, "show": cmd_show, "compare": cmd_compare}[opt.cmd](opt))
+
+
+if __name__ == "__main__":
+    main()
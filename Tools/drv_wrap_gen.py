@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""
+Generate Src/profiling_drv_list.h from StdPeriph driver headers.
+
+usage: drv_wrap_gen.py [--inc DIR] [--out FILE | --no-header] [--ld FILE] [--conf FILE]
+
+Every function prototype of Drivers/STM32F30x_StdPeriph_Driver/inc/*.h
+becomes PROF_DRV_V (void) or PROF_DRV_R (value) X-macro entry, grouped
+by header guard so only modules enabled in stm32f30x_conf.h are wrapped.
+With --ld, GNU ld options "--wrap=<function>" are written one per line,
+only for headers included by --conf (default Src/stm32f30x_conf.h).
+--no-header writes only the --ld list (CMake build), the list header is
+found next to profiling_drv.c and is not taken from the build directory.
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+INC = os.path.join(ROOT, "Drivers", "STM32F30x_StdPeriph_Driver", "inc")
+OUT = os.path.join(ROOT, "Src", "profiling_drv_list.h")
+CONF = os.path.join(ROOT, "Src", "stm32f30x_conf.h")
+
+GUARD = re.compile(r"^#ifndef\s+(__STM32F30x_\w+_H)", re.M)
+PROTO = re.compile(r"^([A-Za-z_][\w \*]*?[\w\*])\s*\b(\w+)\s*\(([^;{]*?)\)\s*;", re.M)
+
+# called by the profiler itself or with calling convention that can not be wrapped
+SKIP = set()
+
+
+def parse_args(params):
+    """ "GPIO_TypeDef* GPIOx, uint16_t Pin" -> "GPIOx, Pin" """
+    params = " ".join(params.split())
+    if params in ("", "void"):
+        return "(void)", "()"
+    names = []
+    for p in params.split(","):
+        m = re.search(r"(\w+)\s*(\[[^\]]*\])?\s*$", p.strip())
+        if not m:
+            raise ValueError("can not parse parameter '%s'" % p)
+        names.append(m.group(1))
+    return "(%s)" % params, "(%s)" % ", ".join(names)
+
+
+def parse_header(path):
+    text = open(path, encoding="latin-1").read()
+    text = re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+    text = re.sub(r"//[^\n]*", "", text)
+    guard = GUARD.search(text)
+    funcs = []
+    for m in PROTO.finditer(text):
+        ret, name, params = m.group(1).strip(), m.group(2), m.group(3)
+        if ret.startswith(("#", "typedef", "return")) or name in SKIP:
+            continue
+        params, args = parse_args(params)
+        funcs.append((" ".join(ret.split()), name, params, args))
+    return guard.group(1) if guard else None, funcs
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("--inc", default=INC)
+    ap.add_argument("--out", default=OUT)
+    ap.add_argument("--no-header", action="store_true", help="do not write --out")
+    ap.add_argument("--ld", help="write GNU ld --wrap options")
+    ap.add_argument("--conf", default=CONF, help="driver configuration, enabled headers")
+    opt = ap.parse_args()
+
+    conf = open(opt.conf, encoding="latin-1").read()
+    enabled = set(re.findall(r'^\s*#include\s+"(stm32f30x_\w+\.h)"', conf, re.M))
+
+    lines = ["/* Generated by Tools/drv_wrap_gen.py, do not edit */", ""]
+    wraps = []
+    total = 0
+    for name in sorted(os.listdir(opt.inc)):
+        if not name.endswith(".h"):
+            continue
+        guard, funcs = parse_header(os.path.join(opt.inc, name))
+        if not guard or not funcs:
+            continue
+        lines.append("#ifdef %s // %s" % (guard, name))
+        for ret, func, params, args in funcs:
+            if ret == "void":
+                lines.append("PROF_DRV_V(%s, %s, %s)" % (func, params, args))
+            else:
+                lines.append("PROF_DRV_R(%s, %s, %s, %s)" % (ret, func, params, args))
+            if name in enabled:
+                wraps.append("--wrap=%s" % func)
+        lines.append("#endif")
+        lines.append("")
+        total += len(funcs)
+
+    if not opt.no_header:
+        with open(opt.out, "w", newline="\n") as f:
+            f.write("\n".join(lines))
+        print("%d functions -> %s" % (total, opt.out), file=sys.stderr)
+    if opt.ld:
+        with open(opt.ld, "w", newline="\n") as f:
+            f.write("\n".join(wraps) + "\n")
+        print("%d wraps -> %s" % (len(wraps), opt.ld), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
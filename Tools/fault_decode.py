@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+"""
+Decode "FAULT-SNAPSHOT" line printed by profiling_fault.c.
+
+usage: fault_decode.py [--elf PROFILER.axf] [--events 8] < swo_log.txt
+
+With --elf, event and session names are read from the image and PC/LR
+are resolved with arm-none-eabi-addr2line (if found in PATH).
+"""
+
+import argparse
+import shutil
+import struct
+import subprocess
+import sys
+
+MAGIC = 0xFA017DB6
+HEADER = ["magic", "vector", "r0", "r1", "r2", "r3", "r12", "lr", "pc", "xpsr",
+          "exc_return", "sp", "cfsr", "hfsr", "mmfar", "bfar",
+          "cyccnt", "core_clock", "prof_name", "event_count"]
+
+VECTORS = {3: "HardFault", 4: "MemManage", 5: "BusFault", 6: "UsageFault"}
+
+CFSR_BITS = [
+    (0, "IACCVIOL: instruction access violation"),
+    (1, "DACCVIOL: data access violation"),
+    (3, "MUNSTKERR: MemManage fault on unstacking"),
+    (4, "MSTKERR: MemManage fault on stacking"),
+    (5, "MLSPERR: MemManage fault on FP lazy state"),
+    (7, "MMARVALID: MMFAR valid"),
+    (8, "IBUSERR: instruction bus error"),
+    (9, "PRECISERR: precise data bus error"),
+    (10, "IMPRECISERR: imprecise data bus error"),
+    (11, "UNSTKERR: BusFault on unstacking"),
+    (12, "STKERR: BusFault on stacking"),
+    (13, "LSPERR: BusFault on FP lazy state"),
+    (15, "BFARVALID: BFAR valid"),
+    (16, "UNDEFINSTR: undefined instruction"),
+    (17, "INVSTATE: invalid EPSR state (Thumb bit)"),
+    (18, "INVPC: invalid EXC_RETURN"),
+    (19, "NOCP: no coprocessor"),
+    (24, "UNALIGNED: unaligned access"),
+    (25, "DIVBYZERO: divide by zero"),
+]
+
+HFSR_BITS = [
+    (1, "VECTTBL: vector table read fault"),
+    (30, "FORCED: escalated configurable fault"),
+    (31, "DEBUGEVT: debug event"),
+]
+
+
+class Elf32:
+    """Minimal ELF32 little-endian reader: read bytes at virtual address."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1:
+            raise ValueError("not an ELF32 file")
+        shoff, = struct.unpack_from("<I", self.data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", self.data, 0x2E)
+        self.sections = []
+        for i in range(shnum):
+            off = shoff + i * shentsize
+            _, sh_type, _, addr, offset, size = struct.unpack_from("<IIIIII", self.data, off)
+            if sh_type == 1 and addr:  # SHT_PROGBITS
+                self.sections.append((addr, offset, size))
+
+    def string(self, addr):
+        for base, offset, size in self.sections:
+            if base <= addr < base + size:
+                start = offset + addr - base
+                end = self.data.index(b"\0", start)
+                return self.data[start:end].decode("latin-1")
+        return None
+
+
+def addr2line(elf, addr):
+    tool = shutil.which("arm-none-eabi-addr2line")
+    if not elf or not tool:
+        return ""
+    out = subprocess.run([tool, "-f", "-p", "-e", elf, "0x%08X" % addr],
+                         capture_output=True, text=True).stdout.strip()
+    return "  (%s)" % out if out else ""
+
+
+def bits(value, table):
+    return [text for bit, text in table if value & (1 << bit)]
+
+
+def decode(words, args, elf):
+    n = args.events
+    if len(words) != len(HEADER) + 2 * n:
+        sys.exit("snapshot has %d words, expected %d (check --events)"
+                 % (len(words), len(HEADER) + 2 * n))
+    f = dict(zip(HEADER, words))
+    if f["magic"] != MAGIC:
+        sys.exit("bad magic 0x%08X" % f["magic"])
+    times = words[len(HEADER):len(HEADER) + n]
+    names = words[len(HEADER) + n:]
+
+    vector = f["vector"]
+    print("Fault: %s (vector %d)" % (VECTORS.get(vector, "?"), vector))
+    print("  PC   0x%08X%s" % (f["pc"], addr2line(args.elf, f["pc"])))
+    print("  LR   0x%08X%s" % (f["lr"], addr2line(args.elf, f["lr"] & ~1)))
+    print("  xPSR 0x%08X  SP 0x%08X  EXC_RETURN 0x%08X (%s stack)"
+          % (f["xpsr"], f["sp"], f["exc_return"],
+             "process" if f["exc_return"] & 4 else "main"))
+    print("  R0 0x%08X R1 0x%08X R2 0x%08X R3 0x%08X R12 0x%08X"
+          % (f["r0"], f["r1"], f["r2"], f["r3"], f["r12"]))
+    print("  CFSR 0x%08X" % f["cfsr"])
+    for text in bits(f["cfsr"], CFSR_BITS):
+        print("    " + text)
+    if f["cfsr"] & (1 << 7):
+        print("    MMFAR 0x%08X" % f["mmfar"])
+    if f["cfsr"] & (1 << 15):
+        print("    BFAR  0x%08X" % f["bfar"])
+    print("  HFSR 0x%08X" % f["hfsr"])
+    for text in bits(f["hfsr"], HFSR_BITS):
+        print("    " + text)
+
+    if not f["prof_name"]:
+        print("No profiling session was running")
+        return
+    tick_per_1us = max(f["core_clock"] // 1000000, 1)
+    name = elf.string(f["prof_name"]) if elf else None
+    print('Last events of "%s":' % (name or "0x%08X" % f["prof_name"]))
+    prev = 0
+    for i in range(min(f["event_count"], n)):
+        event = elf.string(names[i]) if elf else None
+        t = times[i] // tick_per_1us
+        print("  %-30s:%9d us | +%9d us" % (event or "0x%08X" % names[i], t, t - prev))
+        prev = t
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--elf", help="firmware image (.axf/.elf)")
+    parser.add_argument("--events", type=int, default=8, help="PROFILING_FAULT_EVENTS")
+    parser.add_argument("log", nargs="?", type=argparse.FileType("r"), default=sys.stdin)
+    args = parser.parse_args()
+    elf = Elf32(args.elf) if args.elf else None
+
+    found = False
+    for line in args.log:
+        if "FAULT-SNAPSHOT" not in line:
+            continue
+        fields = line.split("FAULT-SNAPSHOT", 1)[1].split()
+        words = [int(x, 16) for x in fields[1:1 + int(fields[0])]]
+        decode(words, args, elf)
+        print()
+        found = True
+    if not found:
+        sys.exit("no FAULT-SNAPSHOT line found")
+
+
+if __name__ == "__main__":
+    main()